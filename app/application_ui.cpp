@@ -33,7 +33,7 @@ SDL_Window* init(string windowTitle, int width, int height)
 //Starts up SDL and creates window
 SDL_Window* init(string windowTitle)
 {
-    init(windowTitle, DEFAULT_SCREEN_HEIGHT, DEFAULT_SCREEN_WIDTH);
+    return init(windowTitle, DEFAULT_SCREEN_WIDTH, DEFAULT_SCREEN_HEIGHT);
 }
 
 SDL_Surface* loadMedia(string path)
@@ -0,0 +1,83 @@
+#include "dessin.h"
+#include "SDL2_gfxPrimitives.h"
+#include <cmath>
+
+void drawPoints(SDL_Renderer *renderer, const std::vector<Coords> &points, const Mesh &mesh)
+{
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        // Les points retirés gardent leur indice mais ne sont plus affichés
+        if (i < mesh.incident.size() && mesh.incident[i] == RETIRE)
+            continue;
+
+        filledCircleRGBA(renderer, points[i].x, points[i].y, 3, 240, 240, 23, SDL_ALPHA_OPAQUE);
+    }
+}
+
+void drawSegments(SDL_Renderer *renderer, const std::vector<Segment> &segments)
+{
+    for (std::size_t i = 0; i < segments.size(); i++)
+    {
+        lineRGBA(
+            renderer,
+            segments[i].p1.x, segments[i].p1.y,
+            segments[i].p2.x, segments[i].p2.y,
+            240, 240, 20, SDL_ALPHA_OPAQUE);
+    }
+}
+
+void drawTriangles(SDL_Renderer *renderer, const Mesh &mesh)
+{
+    for (const Triangle& t : mesh.triangles)
+    {
+        if (!t.vivant || !t.fini())
+            continue;
+
+        const Coords& p1 = mesh.sommet(t.v[0]);
+        const Coords& p2 = mesh.sommet(t.v[1]);
+        const Coords& p3 = mesh.sommet(t.v[2]);
+        trigonRGBA(
+            renderer,
+            p1.x, p1.y,
+            p2.x, p2.y,
+            p3.x, p3.y,
+            0, 240, 160, SDL_ALPHA_OPAQUE
+        );
+    }
+}
+
+void drawPolygon(SDL_Renderer *renderer, const std::vector<Polygon> &polygones)
+{
+    // On préinstancie les vecteurs x et y pour optimiser 
+    std::vector<Sint16> vx;
+    std::vector<Sint16> vy;
+
+    // Pour tous les polygones...
+    for (size_t i=0; i < polygones.size(); i++)
+    {
+        // On récupère le polygone courant (les sites sans cellule n'en ont pas)
+        const Polygon &p = polygones[i];
+        if (p.vertices.size() < 3)
+            continue;
+
+        // On réinitialise les vecteurs x et y
+        vx.clear();
+        vy.clear();
+
+        // On réserve de l'espace pour les coordonnées x et y
+        vx.reserve(p.vertices.size());
+        vy.reserve(p.vertices.size());
+
+        // Pour chaque sommet du polygone...
+        for (const auto& vertex : p.vertices)
+        {
+            // On ajoute les coordonnées x et y des sommets aux vecteurs correspondant, arrondies au pixel
+            // seulement ici pour que les cellules voisines se touchent exactement
+            vx.push_back(std::lround(vertex.x));
+            vy.push_back(std::lround(vertex.y));
+        }
+
+        // Enfin, on dessiner le polygone !
+        filledPolygonRGBA(renderer, vx.data(), vy.data(), vx.size(), p.color.r, p.color.g, p.color.b, SDL_ALPHA_OPAQUE);
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef DESSIN_H
+#define DESSIN_H
+#include <SDL2/SDL.h>
+#include "libvoronoi.h"
+#include <algorithm>
+#include <vector>
+
+// Dessin du maillage et des cellules, partagé par le visualiseur et le banc d'essai (rendu hors écran)
+
+struct Color
+{
+    int r, g, b;
+
+    Color() : r(0), g(0), b(0)
+    {
+    }
+
+    // A l'instanciation d'une couleur, on génère des valeurs RGB équilibrées pour avoir une couleur proche de celle du diagramme de Voronoi
+    // La couleur ne dépend que de la graine et du site : une cellule garde sa couleur quand on la
+    // reconstruit, et deux exécutions identiques donnent les mêmes couleurs
+    Color(unsigned graine, unsigned site)
+    {
+        unsigned h = site ^ (graine * 0x9e3779b9u);
+        h ^= h >> 16;
+        h *= 0x7feb352du;
+        h ^= h >> 15;
+        h *= 0x846ca68bu;
+        h ^= h >> 16;
+
+        int r = h & 255;
+        int g = (h >> 8) & 255;
+        int b = (h >> 16) & 255;
+
+        // On réparti les composantes de manière équilibrée
+        int maxComponent = std::max(r, std::max(g, b));
+        int minComponent = std::min(r, std::min(g, b));
+
+        if (maxComponent - minComponent < 40)
+        {
+            // Si la différence entre la composante maximale et minimale est faible, on ajuste les composantes pour les équilibrer
+            int adjustment = (40 - (maxComponent - minComponent)) / 2;
+            r = std::min(255, r + adjustment);
+            g = std::min(255, g + adjustment);
+            b = std::min(255, b + adjustment);
+        }
+
+        this->r = r;
+        this->g = g;
+        this->b = b;
+    }
+};
+
+// Cellule d'un site découpée par la fenêtre : vide si le site n'a pas de cellule
+struct Polygon
+{
+    std::vector<SommetVoronoi> vertices;
+    Color color;
+};
+
+void drawPoints(SDL_Renderer *renderer, const std::vector<Coords> &points, const Mesh &mesh);
+void drawSegments(SDL_Renderer *renderer, const std::vector<Segment> &segments);
+void drawTriangles(SDL_Renderer *renderer, const Mesh &mesh);
+
+// Dessiner les polygones
+void drawPolygon(SDL_Renderer *renderer, const std::vector<Polygon> &polygones);
+
+#endif
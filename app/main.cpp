@@ -0,0 +1,365 @@
+#include "application_ui.h"
+#include "dessin.h"
+#include "libvoronoi.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+// Position flottante et vitesse d'un site en mode cinétique (en pixels par image)
+struct Mobile
+{
+    double x, y;
+    double vx, vy;
+};
+
+struct Application
+{
+    int width, height;
+    Coords focus{100, 100};
+
+    std::vector<Coords> points;
+    Mesh maillage;
+    OrdreInsertion ordre = OrdreInsertion::Hilbert;
+
+    // Un polygone par site, au même indice que dans points
+    std::vector<Polygon> polygones;
+
+    // Graine des couleurs et des points générés, et nombre de points générés d'un coup
+    unsigned graine = 0;
+    size_t nombreGenere = 1000;
+
+    // Site déplacé à la souris (-1 si aucun)
+    int deplace = -1;
+
+    // Mode cinétique : les sites bougent à chaque image, un mobile par site
+    bool cinetique = false;
+    std::vector<Mobile> mobiles;
+};
+
+void draw(SDL_Renderer *renderer, const Application &app)
+{
+    // Remplissez cette fonction pour faire l'affichage du jeu
+    int width, height;
+    SDL_GetRendererOutputSize(renderer, &width, &height);
+
+    drawPolygon(renderer, app.polygones);
+    drawTriangles(renderer, app.maillage);
+    drawPoints(renderer, app.points, app.maillage);
+}
+
+
+// Construire Delaunay
+void construitDelaunay(Application& app)
+{
+    // On vide la liste de polygones
+    app.polygones.clear();
+
+    // On triangule les points dans le maillage, sans toucher à leur ordre
+    // (on garde les triangles infinis pour pouvoir ajouter ensuite des points n'importe où)
+    if (!construitMaillage(app.maillage, app.points, app.ordre, true))
+        SDL_Log("Des points sortent de la plage de coordonnees supportee !\n");
+}
+
+// Cadre de découpe des cellules : toute la fenêtre
+std::vector<Coords> cadreFenetre(const Application& app)
+{
+    return cadreRectangle(0, 0, app.width, app.height);
+}
+
+// Construire les polygones du diagramme de Voronoi
+void construitPolygones(Application& app)
+{
+    // On vide la liste de polygones
+    app.polygones.assign(app.points.size(), Polygon());
+
+    // On extrait les cellules découpées par la fenêtre : celles des sites de l'enveloppe aussi,
+    // et aucune ne déborde de l'écran ; les sites sont répartis sur tous les coeurs
+    std::vector<Cellule> cellules;
+    construitCellulesBornees(app.maillage, cadreFenetre(app), cellules, 0);
+
+    // On range chaque cellule à l'indice de son site, avec sa couleur
+    for (Cellule& cellule : cellules)
+    {
+        Polygon& polygone = app.polygones[cellule.site];
+        polygone.vertices.swap(cellule.sommets);
+        polygone.color = Color(app.graine, cellule.site);
+    }
+}
+
+// Refaire les cellules des sites touchés par une modification du maillage
+void rafraichitPolygones(Application& app, const std::vector<int>& modifies)
+{
+    app.polygones.resize(app.points.size());
+    const std::vector<Coords> cadre = cadreFenetre(app);
+    for (int site : modifies)
+    {
+        Polygon& polygone = app.polygones[site];
+        if (!construitCelluleBornee(app.maillage, site, cadre, polygone.vertices))
+            polygone.vertices.clear();
+        polygone.color = Color(app.graine, site);
+    }
+}
+
+// Ajouter un point sans tout reconstruire : seules les cellules des sites touchés sont refaites
+void ajoutePointVoronoi(Application& app, Coords point)
+{
+    app.points.push_back(point);
+
+    std::vector<int> modifies;
+    ajoutePoint(app.maillage, point, modifies);
+    rafraichitPolygones(app, modifies);
+}
+
+// Retirer un site : il garde son indice, seul le trou qu'il laisse est retriangulé
+void retirePointVoronoi(Application& app, int site)
+{
+    std::vector<int> modifies;
+    retireSommet(app.maillage, site, modifies);
+    rafraichitPolygones(app, modifies);
+}
+
+// Déplacer un site, sur place s'il reste au milieu de ses voisins
+void deplacePointVoronoi(Application& app, int site, Coords point)
+{
+    std::vector<int> modifies;
+    deplaceSommet(app.maillage, site, point, modifies);
+    app.points[site] = app.maillage.sommets[site];
+    rafraichitPolygones(app, modifies);
+}
+
+// Un pas du mode cinétique : chaque site avance et rebondit sur les bords de la fenêtre
+// Seuls les sites qui changent de pixel sont déplacés dans le maillage, qui est réparé par bascules
+void avanceMobiles(Application& app)
+{
+    // Les sites ajoutés depuis le dernier pas reçoivent une vitesse au hasard
+    std::mt19937 generateur(app.graine + app.mobiles.size());
+    std::uniform_real_distribution<double> vitesse(-1.5, 1.5);
+    while (app.mobiles.size() < app.points.size())
+    {
+        const Coords& p = app.points[app.mobiles.size()];
+        app.mobiles.push_back({(double)p.x, (double)p.y, vitesse(generateur), vitesse(generateur)});
+    }
+
+    std::vector<int> sites;
+    std::vector<Coords> positions;
+    for (size_t i=0; i < app.points.size(); i++)
+    {
+        Mobile& m = app.mobiles[i];
+        if (app.maillage.incident[i] == RETIRE)
+            continue;
+
+        // Le site tenu à la souris ne bouge pas tout seul
+        if ((int)i == app.deplace)
+        {
+            m.x = app.points[i].x;
+            m.y = app.points[i].y;
+            continue;
+        }
+
+        m.x += m.vx;
+        m.y += m.vy;
+        if (m.x < 0 || m.x > app.width)
+        {
+            m.vx = -m.vx;
+            m.x = std::min(std::max(m.x, 0.0), (double)app.width);
+        }
+        if (m.y < 0 || m.y > app.height)
+        {
+            m.vy = -m.vy;
+            m.y = std::min(std::max(m.y, 0.0), (double)app.height);
+        }
+
+        Coords p{(int)std::lround(m.x), (int)std::lround(m.y)};
+        if (!(p == app.points[i]))
+        {
+            sites.push_back(i);
+            positions.push_back(p);
+        }
+    }
+
+    std::vector<int> modifies;
+    deplaceSommets(app.maillage, sites, positions, modifies);
+    for (int site : sites)
+        app.points[site] = app.maillage.sommets[site];
+    rafraichitPolygones(app, modifies);
+}
+
+// Chercher le site le plus proche d'un clic, à quelques pixels près (-1 s'il n'y en a pas)
+int siteProche(const Application& app, Coords point)
+{
+    int proche = -1;
+    long long distanceMin = 6 * 6;
+    for (size_t i=0; i < app.points.size(); i++)
+    {
+        if (i < app.maillage.incident.size() && app.maillage.incident[i] == RETIRE)
+            continue;
+
+        long long dx = app.points[i].x - point.x, dy = app.points[i].y - point.y;
+        if (dx * dx + dy * dy <= distanceMin)
+        {
+            distanceMin = dx * dx + dy * dy;
+            proche = i;
+        }
+    }
+    return proche;
+}
+
+void construitVoronoi(Application &app)
+{
+    // On construit Delaunay
+    construitDelaunay(app);
+
+    // On construit les polygones du diagramme
+    construitPolygones(app);
+}
+
+// Gérer les input utilisateur
+bool handleEvent(Application &app)
+{
+    SDL_Event e;
+    while (SDL_PollEvent(&e))
+    {
+        if (e.type == SDL_QUIT)
+            return false;
+        else if (e.type == SDL_WINDOWEVENT_RESIZED)
+        {
+            app.width = e.window.data1;
+            app.height = e.window.data1;
+        }
+        else if (e.type == SDL_MOUSEWHEEL)
+        {
+        }
+        else if (e.type == SDL_KEYUP)
+        {
+            SDL_Keycode touche = e.key.keysym.sym;
+
+            // Les touches 1 à 6 remplacent les points par une répartition générée :
+            // uniforme, Poisson, amas, grille, cercle, doublons
+            if (touche >= SDLK_1 && touche <= SDLK_6)
+            {
+                Distribution distribution = (Distribution)(touche - SDLK_1);
+                app.points = generePoints<int>(distribution, app.nombreGenere, app.width, app.height, app.graine++);
+                app.mobiles.clear();
+                SDL_Log("%zu points, repartition %s\n", app.points.size(), nomDistribution(distribution));
+                construitVoronoi(app);
+            }
+            // La touche K lance ou arrête le mode cinétique
+            else if (touche == SDLK_k)
+            {
+                app.cinetique = !app.cinetique;
+                SDL_Log("Mode cinetique %s\n", app.cinetique ? "actif" : "arrete");
+            }
+            // Les flèches haut et bas multiplient ou divisent par 10 le nombre de points générés
+            else if (touche == SDLK_UP)
+            {
+                app.nombreGenere *= 10;
+                SDL_Log("%zu points par generation\n", app.nombreGenere);
+            }
+            else if (touche == SDLK_DOWN && app.nombreGenere >= 10)
+            {
+                app.nombreGenere /= 10;
+                SDL_Log("%zu points par generation\n", app.nombreGenere);
+            }
+        }
+        // Un clic gauche sur un site commence à le déplacer
+        else if (e.type == SDL_MOUSEBUTTONDOWN)
+        {
+            if (e.button.button == SDL_BUTTON_LEFT)
+                app.deplace = siteProche(app, Coords{e.button.x, e.button.y});
+        }
+        else if (e.type == SDL_MOUSEMOTION)
+        {
+            if (app.deplace != -1)
+                deplacePointVoronoi(app, app.deplace, Coords{e.motion.x, e.motion.y});
+        }
+        else if (e.type == SDL_MOUSEBUTTONUP)
+        {
+            // Un clic droit retire le site visé, ou tous les points s'il n'y en a pas
+            if (e.button.button == SDL_BUTTON_RIGHT)
+            {
+                int site = siteProche(app, Coords{e.button.x, e.button.y});
+                if (site != -1)
+                {
+                    retirePointVoronoi(app, site);
+                }
+                else
+                {
+                    app.focus.x = e.button.x;
+                    app.focus.y = e.button.y;
+                    app.points.clear();
+                    app.maillage.clear();
+                    app.polygones.clear();
+                    app.mobiles.clear();
+                }
+            }
+            else if (e.button.button == SDL_BUTTON_LEFT)
+            {
+                // Fin d'un déplacement, sinon on ajoute un point
+                if (app.deplace != -1)
+                {
+                    app.deplace = -1;
+                }
+                else
+                {
+                    app.focus.y = 0;
+                    ajoutePointVoronoi(app, Coords{e.button.x, e.button.y});
+                }
+            }
+        }
+    }
+    return true;
+}
+
+int main(int, char **)
+{
+    SDL_Window *gWindow;
+    SDL_Renderer *renderer;
+    Application app{};
+    app.width = app.height = 720;
+    app.focus = Coords{0, 0};
+    bool is_running = true;
+
+    // Creation de la fenetre
+    gWindow = init("Awesome Voronoi", 720, 720);
+
+    if (!gWindow)
+    {
+        SDL_Log("Failed to initialize!\n");
+        exit(1);
+    }
+
+    renderer = SDL_CreateRenderer(gWindow, -1, 0); // SDL_RENDERER_PRESENTVSYNC
+
+    // MAIN LOOP
+    while (true)
+    {
+        // INPUTS
+        is_running = handleEvent(app);
+        if (!is_running)
+            break;
+
+        // MOUVEMENT
+        if (app.cinetique)
+            avanceMobiles(app);
+
+        // EFFACAGE FRAME
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+        
+
+        // DESSIN
+        draw(renderer, app);
+
+        // VALIDATION FRAME
+        SDL_RenderPresent(renderer);
+
+        // PAUSE en ms
+        SDL_Delay(1000 / 30);
+    }
+
+    // Libère les ressources et ferme SDL
+    close(gWindow, renderer);
+
+    return 0;
+}
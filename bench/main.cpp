@@ -0,0 +1,649 @@
+#include "libvoronoi.h"
+#include "predicates.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef VORONOI_BENCH_RENDU
+#include "dessin.h"
+#endif
+
+// Banc d'essai de la chaîne Delaunay / Voronoi : mesure chaque étape sur plusieurs tailles
+// et plusieurs répartitions de points, et écrit les résultats en JSON
+
+// On compte les allocations de tout le programme en remplaçant l'opérateur new
+// (GCC croit voir un free sur un pointeur venant de new une fois ces opérateurs inlinés)
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static std::atomic<long long> allocations(0);
+
+void* operator new(std::size_t taille)
+{
+    allocations++;
+    if (void* p = std::malloc(taille ? taille : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+// Résultat d'une étape, écrit comme un objet JSON
+struct Mesure
+{
+    const char* distribution;
+    int n;
+    const char* etape;
+    double ms;
+    double testsCercle, testsExacts, allocations;
+};
+
+static void ecritMesure(FILE* sortie, const Mesure& m, bool premiere)
+{
+    std::fprintf(sortie, "%s\n    {\"distribution\": \"%s\", \"n\": %d, \"etape\": \"%s\", \"ms\": %.4f, \"ns_par_point\": %.2f",
+        premiere ? "" : ",", m.distribution, m.n, m.etape, m.ms, m.ms * 1e6 / m.n);
+    if (m.testsCercle >= 0)
+        std::fprintf(sortie, ", \"tests_cercle_par_point\": %.3f, \"tests_exacts_par_point\": %.4f", m.testsCercle / m.n, m.testsExacts / m.n);
+    std::fprintf(sortie, ", \"allocations_par_point\": %.4f}", m.allocations / m.n);
+}
+
+// Chronomètre une fonction : meilleur temps sur plusieurs essais, allocations du dernier essai
+template <typename F>
+static double chronometre(int essais, long long& alloue, F&& f)
+{
+    double meilleur = 1e300;
+    for (int e=0; e < essais; e++)
+    {
+        long long avant = allocations;
+        auto debut = std::chrono::steady_clock::now();
+        f();
+        auto fin = std::chrono::steady_clock::now();
+        alloue = allocations - avant;
+        meilleur = std::min(meilleur, std::chrono::duration<double, std::milli>(fin - debut).count());
+    }
+    return meilleur;
+}
+
+// Micro-mesures des prédicats sur des points tirés au hasard
+static void mesurePredicats(FILE* sortie, bool& premiere)
+{
+    const int n = 1 << 20;
+    std::mt19937 generateur(1);
+    std::uniform_int_distribution<int> u(0, (1 << 20) - 1);
+    std::vector<Coords> p(n + 3);
+    for (Coords& c : p)
+        c = {u(generateur), u(generateur)};
+
+    long long alloue = 0;
+    volatile double puits = 0;
+
+    double ms = chronometre(5, alloue, [&]{
+        double s = 0;
+        for (int i=0; i < n; i++)
+            s += orient2d(p[i].x, p[i].y, p[i+1].x, p[i+1].y, p[i+2].x, p[i+2].y) > 0;
+        puits = s;
+    });
+    ecritMesure(sortie, {"aleatoire", n, "orient2d", ms, -1, -1, (double)alloue}, premiere);
+    premiere = false;
+
+    ms = chronometre(5, alloue, [&]{
+        double s = 0;
+        for (int i=0; i < n; i++)
+            s += incircle(p[i].x, p[i].y, p[i+1].x, p[i+1].y, p[i+2].x, p[i+2].y, p[i+3].x, p[i+3].y) > 0;
+        puits = s;
+    });
+    ecritMesure(sortie, {"aleatoire", n, "incircle", ms, -1, -1, (double)alloue}, premiere);
+
+    ms = chronometre(5, alloue, [&]{
+        double s = 0;
+        for (int i=0; i < n; i++)
+            s += Predicats<int>::dansCercle(p[i].x, p[i].y, p[i+1].x, p[i+1].y, p[i+2].x, p[i+2].y, p[i+3].x, p[i+3].y) > 0;
+        puits = s;
+    });
+    ecritMesure(sortie, {"aleatoire", n, "dansCercle_int", ms, -1, -1, (double)alloue}, premiere);
+    (void)puits;
+}
+
+#ifdef VORONOI_BENCH_RENDU
+// Côté de la surface du rendu hors écran, en pixels
+static const int COTE_RENDU = 1024;
+
+// Dessin des cellules avec le code du visualiseur, dans une surface en mémoire par le rendu logiciel
+// de SDL (sans fenêtre) ; les cellules sont ramenées du carré des points à la taille de la surface
+static void mesureDessin(FILE* sortie, const char* nom, int n, const std::vector<Cellule>& cellules, int essais, bool& premiere)
+{
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, COTE_RENDU, COTE_RENDU, 32, SDL_PIXELFORMAT_RGBA8888);
+    SDL_Renderer* renderer = surface ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (!renderer)
+    {
+        std::fprintf(stderr, "Rendu logiciel indisponible : %s\n", SDL_GetError());
+        if (surface)
+            SDL_FreeSurface(surface);
+        return;
+    }
+
+    const double echelle = (double)COTE_RENDU / (1 << 20);
+    std::vector<Polygon> polygones(cellules.size());
+    for (size_t i=0; i < cellules.size(); i++)
+    {
+        for (const SommetVoronoi& P : cellules[i].sommets)
+            polygones[i].vertices.push_back({P.x * echelle, P.y * echelle});
+        polygones[i].color = Color(1, cellules[i].site);
+    }
+
+    long long alloue = 0;
+    double ms = chronometre(essais, alloue, [&]{
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+        drawPolygon(renderer, polygones);
+    });
+    ecritMesure(sortie, {nom, n, "dessin", ms, -1, -1, (double)alloue}, premiere);
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+}
+#endif
+
+// Macro-mesures de la chaîne complète pour une répartition et une taille
+static void mesureChaine(FILE* sortie, Distribution d, int n, int maxVoronoi, int threads, bool& premiere)
+{
+    const char* nom = nomDistribution(d);
+    std::vector<Coords> points = generePoints<int>(d, n, 1 << 20, 1 << 20, 1);
+    const int essais = std::max(1, std::min(5, 1000000 / n));
+    long long alloue = 0;
+
+    std::vector<int> ordre;
+    double ms = chronometre(essais, alloue, [&]{ ordre = ordreInsertion(points, OrdreInsertion::Hilbert); });
+    ecritMesure(sortie, {nom, n, "ordre", ms, -1, -1, (double)alloue}, premiere);
+    premiere = false;
+
+    // Le maillage est recréé à chaque essai pour mesurer aussi ses allocations
+    Mesh mesh;
+    ms = chronometre(essais, alloue, [&]{
+        mesh = Mesh();
+        trianguleDelaunay(mesh, points, ordre);
+    });
+    ecritMesure(sortie, {nom, n, "delaunay", ms, (double)mesh.stats.testsCercle, (double)mesh.stats.testsExacts, (double)alloue}, premiere);
+
+    // La même triangulation par bandes sur plusieurs threads, sauf si on n'en demande qu'un
+    if (threads != 1)
+    {
+        Mesh parallele;
+        ms = chronometre(essais, alloue, [&]{
+            parallele = Mesh();
+            trianguleDelaunayParallele(parallele, points, threads);
+        });
+        ecritMesure(sortie, {nom, n, "delaunay_parallele", ms, (double)parallele.stats.testsCercle, (double)parallele.stats.testsExacts, (double)alloue}, premiere);
+    }
+
+    // Le moteur diviser pour régner, sur un thread puis sur plusieurs
+    Mesh division;
+    ms = chronometre(essais, alloue, [&]{
+        division = Mesh();
+        trianguleDivision(division, points);
+    });
+    ecritMesure(sortie, {nom, n, "delaunay_division", ms, (double)division.stats.testsCercle, (double)division.stats.testsExacts, (double)alloue}, premiere);
+    if (threads != 1)
+    {
+        ms = chronometre(essais, alloue, [&]{
+            division = Mesh();
+            trianguleDivision(division, points, threads);
+        });
+        ecritMesure(sortie, {nom, n, "delaunay_division_parallele", ms, (double)division.stats.testsCercle, (double)division.stats.testsExacts, (double)alloue}, premiere);
+    }
+
+    // La même insertion découpée en ses deux étapes : localisation du triangle qui contient le point,
+    // puis cavité (triangles en conflit, bord, nouveaux triangles et leur liaison) ; insereSommet repart
+    // du triangle trouvé et n'a plus à marcher. Les premiers points sont posés par trianguleDelaunay
+    // On lit l'horloge et le compteur d'allocations autour de chaque étape de chaque point, ce qui ajoute
+    // quelques dizaines de nanosecondes par point à chacune ; comme pour chronometre, les allocations
+    // sont celles du dernier essai
+    const std::vector<int> amorce(ordre.begin(), ordre.begin() + std::min<size_t>(ordre.size(), 16));
+    double localisation = 1e300, cavite = 1e300;
+    long long alloueLocalisation = 0, alloueCavite = 0;
+    Mesh etapes;
+    for (int e=0; e < essais; e++)
+    {
+        etapes = Mesh();
+        trianguleDelaunay(etapes, points, amorce);
+        if (etapes.dernier == -1)
+            break;
+
+        alloueLocalisation = alloueCavite = 0;
+        std::chrono::steady_clock::duration dureeLocalisation{}, dureeCavite{};
+        for (size_t k=amorce.size(); k < ordre.size(); k++)
+        {
+            const long long a0 = allocations;
+            auto t0 = std::chrono::steady_clock::now();
+            etapes.dernier = localiseTriangle(etapes, points[ordre[k]], etapes.dernier);
+            auto t1 = std::chrono::steady_clock::now();
+            const long long a1 = allocations;
+            insereSommet(etapes, ordre[k]);
+            auto t2 = std::chrono::steady_clock::now();
+            alloueLocalisation += a1 - a0;
+            alloueCavite += allocations - a1;
+            dureeLocalisation += t1 - t0;
+            dureeCavite += t2 - t1;
+        }
+        localisation = std::min(localisation, std::chrono::duration<double, std::milli>(dureeLocalisation).count());
+        cavite = std::min(cavite, std::chrono::duration<double, std::milli>(dureeCavite).count());
+    }
+    if (etapes.dernier != -1)
+    {
+        ecritMesure(sortie, {nom, n, "insertion_localisation", localisation, -1, -1, (double)alloueLocalisation}, premiere);
+        ecritMesure(sortie, {nom, n, "insertion_cavite", cavite, (double)etapes.stats.testsCercle, (double)etapes.stats.testsExacts, (double)alloueCavite}, premiere);
+    }
+
+    // Localisation seule de tous les points dans le maillage fini, depuis le triangle précédent
+    ms = chronometre(essais, alloue, [&]{
+        int t = mesh.dernier;
+        for (int i : ordre)
+        {
+            int u = localiseTriangle(mesh, points[i], t);
+            if (u != -1)
+                t = u;
+        }
+    });
+    ecritMesure(sortie, {nom, n, "localisation", ms, -1, -1, (double)alloue}, premiere);
+
+    // Un pas du mode cinétique : chaque point bouge d'un seizième de l'écart moyen entre points,
+    // alternativement dans un sens puis dans l'autre, et le maillage est réparé par bascules
+    std::vector<int> sites(n);
+    std::vector<Coords> aller(n), retour(points);
+    std::mt19937 generateur(2);
+    const int amplitude = std::max(1, (int)((1 << 20) / std::sqrt((double)n) / 16));
+    std::uniform_int_distribution<int> pas(-amplitude, amplitude);
+    for (int i=0; i < n; i++)
+    {
+        sites[i] = i;
+        aller[i] = {points[i].x + pas(generateur), points[i].y + pas(generateur)};
+    }
+    std::vector<int> modifies;
+    bool sens = true;
+    const long long testsAvant = mesh.stats.testsCercle, exactsAvant = mesh.stats.testsExacts;
+    ms = chronometre(essais, alloue, [&]{
+        deplaceSommets(mesh, sites, sens ? aller : retour, modifies);
+        sens = !sens;
+    });
+    ecritMesure(sortie, {nom, n, "cinetique", ms, (double)(mesh.stats.testsCercle - testsAvant) / essais,
+        (double)(mesh.stats.testsExacts - exactsAvant) / essais, (double)alloue}, premiere);
+
+    retireTrianglesInfinis(mesh);
+
+    if (n <= maxVoronoi)
+    {
+        std::vector<Cellule> cellules;
+        ms = chronometre(essais, alloue, [&]{ construitCellules(mesh, cellules); });
+        ecritMesure(sortie, {nom, n, "voronoi", ms, -1, -1, (double)alloue}, premiere);
+
+        // Diagramme compact : sommets partagés, cellules en indices et arêtes avec leurs sites
+        Diagramme diagramme;
+        ms = chronometre(essais, alloue, [&]{ construitDiagramme(mesh, diagramme); });
+        ecritMesure(sortie, {nom, n, "diagramme", ms, -1, -1, (double)alloue}, premiere);
+
+        // Le même diagramme sur plusieurs threads, sauf si on n'en demande qu'un
+        if (threads != 1)
+        {
+            ms = chronometre(essais, alloue, [&]{ construitDiagramme(mesh, diagramme, threads); });
+            ecritMesure(sortie, {nom, n, "diagramme_parallele", ms, -1, -1, (double)alloue}, premiere);
+        }
+
+        // Le même diagramme directement depuis les points par le balayage de Fortune, à comparer
+        // à la somme de delaunay et de diagramme : les sites sont ceux du maillage, là où le mode
+        // cinétique les a laissés
+        // Une cellule qui ne se referme pas (sommet dédoublé par l'arrondi) est laissée vide : on le signale
+        bool fermees = true;
+        ms = chronometre(essais, alloue, [&]{ fermees = construitDiagrammeFortune(mesh.sommets, diagramme); });
+        ecritMesure(sortie, {nom, n, "fortune", ms, -1, -1, (double)alloue}, premiere);
+        if (!fermees)
+            std::fprintf(stderr, "%s, n = %d : des cellules du balayage de Fortune ne se referment pas\n", nom, n);
+
+        // Cellules de tous les sites, celles de l'enveloppe comprises, découpées par le carré des points
+        const std::vector<Coords> cadre = cadreRectangle(0, 0, 1 << 20, 1 << 20);
+        ms = chronometre(essais, alloue, [&]{ construitCellulesBornees(mesh, cadre, cellules); });
+        ecritMesure(sortie, {nom, n, "voronoi_borne", ms, -1, -1, (double)alloue}, premiere);
+
+#ifdef VORONOI_BENCH_RENDU
+        mesureDessin(sortie, nom, n, cellules, essais, premiere);
+#endif
+    }
+}
+
+// Vérification du mode cinétique sur une répartition, pour les essais plutôt que pour les mesures :
+// des pas où quelques points bougent un peu (réparés sur place) alternent avec des pas où un point sur
+// quatre saute sur la place d'un autre (reconstruction complète, sauf sur un petit maillage) ; des points confondus se forment,
+// se séparent et prennent la place de sommets qui partent, parfois déjà prise par un voisin qui y
+// arrive au même pas. Après chaque pas, les cycles de points confondus doivent être valides, et les
+// cellules tenues à jour comme dans le visualiseur (refaites pour les seuls sites signalés) doivent être
+// celles que l'on construit à nouveau pour tous les sites. Retourne le nombre d'erreurs
+static int verifieCinetique(Distribution d, int n)
+{
+    const char* nom = nomDistribution(d);
+    const int cote = 1 << 20;
+    Mesh mesh;
+    construitMaillage(mesh, generePoints<int>(d, n, cote, cote, 1), OrdreInsertion::Hilbert, true);
+
+    std::mt19937 generateur(3);
+    const int amplitude = std::max(1, (int)(cote / std::sqrt((double)n) / 4));
+    std::uniform_int_distribution<int> pas(-amplitude, amplitude);
+    std::vector<int> sites, modifies;
+    std::vector<Coords> positions;
+    std::vector<char> bouge(n);
+
+    // Cellule d'un site, ses sommets triés pour ne pas dépendre du triangle où l'on commence le tour
+    // (vide pour un site de l'enveloppe ou hors du maillage)
+    auto cellule = [&](int s){
+        std::vector<SommetVoronoi> sommets;
+        if (!construitCellule(mesh, s, sommets))
+            sommets.clear();
+        std::sort(sommets.begin(), sommets.end(), [](const SommetVoronoi& a, const SommetVoronoi& b){
+            return a.x < b.x || (a.x == b.x && a.y < b.y);
+        });
+        return sommets;
+    };
+    std::vector<std::vector<SommetVoronoi>> cellules(n);
+    for (int s=0; s < n; s++)
+        cellules[s] = cellule(s);
+
+    for (int etape=0; etape < 500; etape++)
+    {
+        const bool saute = etape % 10 == 9;
+        sites.clear();
+        positions.clear();
+        std::fill(bouge.begin(), bouge.end(), 0);
+        for (int s=0; s < n; s++)
+        {
+            if (mesh.incident[s] == RETIRE || generateur() % (saute ? 4 : 16) != 0)
+                continue;
+            const Coords& P = mesh.sommets[s];
+            sites.push_back(s);
+            bouge[s] = 1;
+
+            // Un voisin déjà déplacé à ce pas laisse sa place libre
+            int voisin = -1;
+            if (mesh.incident[s] >= 0)
+            {
+                for (int v : mesh.triangles[mesh.incident[s]].v)
+                {
+                    if (v != INFINI && v < s && bouge[v])
+                        voisin = v;
+                }
+            }
+
+            if (saute || generateur() % 8 == 0)
+                positions.push_back(mesh.sommets[generateur() % n]);
+            else if (voisin != -1 && generateur() % 2 == 0)
+                positions.push_back(mesh.sommets[voisin]);
+            else
+                positions.push_back({std::clamp(P.x + pas(generateur), 0, cote - 1), std::clamp(P.y + pas(generateur), 0, cote - 1)});
+        }
+        deplaceSommets(mesh, sites, positions, modifies);
+
+        if (!jumeauxCoherents(mesh))
+        {
+            std::fprintf(stderr, "%s, n = %d, pas %d : un point n'est ni dans le maillage ni dans un cycle valide\n", nom, n, etape);
+            return 1;
+        }
+
+        for (int s : modifies)
+            cellules[s] = cellule(s);
+        for (int s=0; s < n; s++)
+        {
+            if (cellules[s] != cellule(s))
+            {
+                std::fprintf(stderr, "%s, n = %d, pas %d%s : la cellule du site %d a change sans etre signalee\n",
+                    nom, n, etape, saute ? " (sauts)" : "", s);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// Point entier tiré au hasard strictement à l'intérieur d'une arête de l'enveloppe (sans voisin) d'un
+// maillage sans triangles infinis ; retourne false si aucune des arêtes essayées n'en a
+static bool pointSurEnveloppe(const Mesh& mesh, std::mt19937& generateur, Coords& P)
+{
+    for (int essai=0; essai < 64; essai++)
+    {
+        const Triangle& T = mesh.triangles[generateur() % mesh.triangles.size()];
+        for (int i=0; i < 3 && T.vivant; i++)
+        {
+            if (T.voisins[i] != -1)
+                continue;
+
+            // Les points entiers de l'arête (a, b) sont a + k (b - a) / g, avec g le pgcd des écarts
+            const Coords& a = mesh.sommet(T.v[(i + 1) % 3]);
+            const Coords& b = mesh.sommet(T.v[(i + 2) % 3]);
+            const int g = std::gcd(std::abs(b.x - a.x), std::abs(b.y - a.y));
+            if (g < 2)
+                continue;
+            const int k = 1 + generateur() % (g - 1);
+            P = {a.x + k * ((b.x - a.x) / g), a.y + k * ((b.y - a.y) / g)};
+            return true;
+        }
+    }
+    return false;
+}
+
+// Vérifie qu'aucun triangle fini vivant n'est plat ni retourné
+static bool trianglesDirects(const Mesh& mesh)
+{
+    for (const Triangle& T : mesh.triangles)
+    {
+        if (!T.vivant || !T.fini())
+            continue;
+        const Coords& a = mesh.sommet(T.v[0]);
+        const Coords& b = mesh.sommet(T.v[1]);
+        const Coords& c = mesh.sommet(T.v[2]);
+        if (Predicats<int>::orient(a.x, a.y, b.x, b.y, c.x, c.y) <= 0)
+            return false;
+    }
+    return true;
+}
+
+// Vérification d'un maillage sans triangles infinis, pour les essais : des points sont ajoutés au hasard
+// dans le carré (parfois hors de l'enveloppe) ou sur une arête de l'enveloppe, où ils doivent être
+// refusés, et des sites sont déplacés sur une arête de l'enveloppe, d'où ils doivent revenir à leur place ;
+// après chaque pas, aucun triangle n'est plat et les cellules des sites signalés sont finies
+// Retourne le nombre d'erreurs
+static int verifieEnveloppe(Distribution d, int n)
+{
+    const char* nom = nomDistribution(d);
+    const int cote = 1 << 20;
+    Mesh mesh;
+    construitMaillage(mesh, generePoints<int>(d, n, cote, cote, 1), OrdreInsertion::Hilbert, false);
+
+    std::mt19937 generateur(4);
+    std::uniform_int_distribution<int> u(0, cote - 1);
+    std::vector<int> modifies;
+    std::vector<SommetVoronoi> sommets;
+    for (int etape=0; etape < 300; etape++)
+    {
+        Coords P = {u(generateur), u(generateur)};
+        const bool surBord = etape % 3 != 2 && pointSurEnveloppe(mesh, generateur, P);
+        if (etape % 3 == 1 && surBord)
+        {
+            const int s = generateur() % mesh.sommets.size();
+            const Coords ancien = mesh.sommets[s];
+            if (mesh.incident[s] != RETIRE && !(ancien == P)
+                && (deplaceSommet(mesh, s, P, modifies) || !(mesh.sommets[s] == ancien)))
+            {
+                std::fprintf(stderr, "%s, n = %d, pas %d : le site %d deplace sur l'enveloppe n'est pas revenu\n", nom, n, etape, s);
+                return 1;
+            }
+        }
+        else if (ajoutePoint(mesh, P, modifies) && surBord)
+        {
+            std::fprintf(stderr, "%s, n = %d, pas %d : un point sur l'enveloppe a ete insere\n", nom, n, etape);
+            return 1;
+        }
+        if (!trianglesDirects(mesh) || !jumeauxCoherents(mesh))
+        {
+            std::fprintf(stderr, "%s, n = %d, pas %d : maillage invalide\n", nom, n, etape);
+            return 1;
+        }
+        for (int s : modifies)
+        {
+            if (!construitCellule(mesh, s, sommets))
+                continue;
+            for (const SommetVoronoi& S : sommets)
+            {
+                if (!std::isfinite(S.x) || !std::isfinite(S.y))
+                {
+                    std::fprintf(stderr, "%s, n = %d, pas %d : la cellule du site %d n'est pas finie\n", nom, n, etape, s);
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// Vérification du balayage de Fortune en coordonnées 64 bits loin de l'origine, pour les essais : les
+// points d'une répartition sont décalés de decalage sur les deux axes, et le diagramme doit avoir les
+// mêmes cellules (en nombre de sommets) et les mêmes arêtes finies (en paires de sites) que celui de la
+// triangulation. Les répartitions cocycliques (grille, cercle) sont laissées de côté : leurs sommets
+// dédoublés par l'arrondi peuvent y différer. Retourne le nombre d'erreurs
+static int verifieFortune(Distribution d, int n, std::int64_t decalage)
+{
+    typedef Point<std::int64_t> Point64;
+    const char* nom = nomDistribution(d);
+    std::vector<Point64> points = generePoints<std::int64_t>(d, n, 1 << 20, 1 << 20, 1);
+    for (Point64& P : points)
+        P = {P.x + decalage, P.y + decalage};
+
+    BasicMesh<std::int64_t> mesh;
+    construitMaillage(mesh, points);
+    Diagramme triangulation, balayage;
+    construitDiagramme(mesh, triangulation);
+    if (!construitDiagrammeFortune(points, balayage))
+    {
+        std::fprintf(stderr, "%s, n = %d, decalage %lld : des cellules du balayage de Fortune ne se referment pas\n", nom, n, (long long)decalage);
+        return 1;
+    }
+
+    auto paires = [](const Diagramme& diagramme){
+        std::vector<std::pair<int, int>> resultat;
+        for (const AreteVoronoi& A : diagramme.aretes)
+            resultat.push_back({std::min(A.gauche, A.droite), std::max(A.gauche, A.droite)});
+        std::sort(resultat.begin(), resultat.end());
+        return resultat;
+    };
+    bool memesCellules = true;
+    for (int s=0; s < n; s++)
+        memesCellules = memesCellules && triangulation.nombreSommets(s) == balayage.nombreSommets(s);
+    if (!memesCellules || paires(triangulation) != paires(balayage))
+    {
+        std::fprintf(stderr, "%s, n = %d, decalage %lld : le diagramme de Fortune differe de celui de la triangulation\n", nom, n, (long long)decalage);
+        return 1;
+    }
+    return 0;
+}
+
+static void usage()
+{
+    std::fprintf(stderr,
+        "usage : voronoi_bench [options]\n"
+        "  -o, --sortie FICHIER    ecrit le JSON dans FICHIER plutot que sur la sortie standard\n"
+        "      --max N             plus grande taille mesuree (defaut 1000000)\n"
+        "      --max-voronoi N     plus grande taille pour l'extraction des cellules (defaut : celle de --max)\n"
+        "  -j, --threads N         threads des etapes paralleles, 0 pour tous les coeurs (defaut 0)\n"
+        "      --verifie           verifie le mode cinetique, les ajouts sans triangles infinis et le balayage\n"
+        "                          de Fortune loin de l'origine sur chaque repartition au lieu de mesurer\n");
+}
+
+int main(int argc, char** argv)
+{
+    std::string chemin;
+    int maxPoints = 1000000;
+    int maxVoronoi = -1;
+    int threads = 0;
+    bool verifie = false;
+    for (int i=1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if ((arg == "-o" || arg == "--sortie") && i + 1 < argc)
+            chemin = argv[++i];
+        else if (arg == "--max" && i + 1 < argc)
+            maxPoints = std::atoi(argv[++i]);
+        else if (arg == "--max-voronoi" && i + 1 < argc)
+            maxVoronoi = std::atoi(argv[++i]);
+        else if ((arg == "-j" || arg == "--threads") && i + 1 < argc)
+            threads = std::atoi(argv[++i]);
+        else if (arg == "--verifie")
+            verifie = true;
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    const Distribution distributions[] = {
+        Distribution::Uniforme, Distribution::Poisson, Distribution::Amas,
+        Distribution::Grille, Distribution::Cercle, Distribution::Doublons
+    };
+
+    if (verifie)
+    {
+        int erreurs = 0;
+        for (Distribution d : distributions)
+        {
+            erreurs += verifieCinetique(d, 20) + verifieCinetique(d, 2000) + verifieEnveloppe(d, 2000);
+#ifdef __SIZEOF_INT128__
+            if (d != Distribution::Grille && d != Distribution::Cercle)
+            {
+                for (int decalage : {0, 55, 61})
+                    erreurs += verifieFortune(d, 20000, decalage ? ((std::int64_t)1 << decalage) - (1 << 20) : 0);
+            }
+#endif
+        }
+        std::fprintf(stderr, "Verification : %d erreur(s)\n", erreurs);
+        return erreurs ? 1 : 0;
+    }
+
+    // L'extraction des cellules suit le nombre de triangles : on la mesure à toutes les tailles
+    if (maxVoronoi < 0)
+        maxVoronoi = maxPoints;
+
+    FILE* sortie = chemin.empty() ? stdout : std::fopen(chemin.c_str(), "w");
+    if (!sortie)
+    {
+        std::fprintf(stderr, "Impossible d'ecrire %s\n", chemin.c_str());
+        return 1;
+    }
+
+    std::fprintf(sortie, "{\n  \"mesures\": [");
+    bool premiere = true;
+    mesurePredicats(sortie, premiere);
+
+    for (Distribution d : distributions)
+    {
+        for (int n = 1000; n <= maxPoints; n *= 10)
+            mesureChaine(sortie, d, n, maxVoronoi, threads, premiere);
+    }
+    std::fprintf(sortie, "\n  ]\n}\n");
+
+    if (sortie != stdout)
+        std::fclose(sortie);
+    return 0;
+}
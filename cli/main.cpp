@@ -0,0 +1,342 @@
+#include "libvoronoi.h"
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+// Outil en ligne de commande : construit la triangulation et les cellules de Voronoi d'un
+// fichier de points, sans affichage, et donne le temps de chaque étape
+
+struct Options
+{
+    std::string entree;
+    std::string sortie;
+    std::string type = "int";
+    MoteurDelaunay moteur = MoteurDelaunay::Insertion;
+    OrdreInsertion ordre = OrdreInsertion::Hilbert;
+    unsigned graine = 0;
+    int threads = 1;
+};
+
+static void usage()
+{
+    std::fprintf(stderr,
+        "usage : voronoi_cli [options] points.txt\n"
+        "  -o, --sortie FICHIER   ecrit les triangles et les cellules dans FICHIER\n"
+        "  -t, --type TYPE        type des coordonnees : int (defaut), int64, float, double\n"
+        "  -m, --moteur MOTEUR    moteur de la triangulation : insertion (defaut), division\n"
+        "      --ordre ORDRE      ordre d'insertion : lignes, hilbert (defaut), brio\n"
+        "      --graine N         graine du melange de l'ordre brio\n"
+        "  -j, --threads N        threads de la triangulation et de l'extraction des cellules,\n"
+        "                         0 pour tous les coeurs (defaut 1)\n"
+        "Le fichier contient deux coordonnees par point, separees par des blancs ;\n"
+        "les lignes qui commencent par # sont ignorees.\n");
+}
+
+// Lit tout le texte comme un entier de [min, max] ; retourne false s'il reste autre chose que le nombre
+// ou s'il sort de l'intervalle (débordement compris)
+template <typename N>
+static bool litEntier(const char* texte, N min, N max, N& valeur)
+{
+    char* fin;
+    errno = 0;
+    long long lu = std::strtoll(texte, &fin, 10);
+    if (fin == texte || *fin != '\0' || errno == ERANGE || lu < (long long)min || lu > (long long)max)
+        return false;
+    valeur = lu;
+    return true;
+}
+
+static bool litOptions(int argc, char** argv, Options& options)
+{
+    for (int i=1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool valeur = i + 1 < argc;
+
+        if ((arg == "-o" || arg == "--sortie") && valeur)
+            options.sortie = argv[++i];
+        else if ((arg == "-t" || arg == "--type") && valeur)
+            options.type = argv[++i];
+        else if ((arg == "-j" || arg == "--threads") && valeur)
+        {
+            if (!litEntier(argv[++i], 0, std::numeric_limits<int>::max(), options.threads))
+                return false;
+        }
+        else if (arg == "--graine" && valeur)
+        {
+            if (!litEntier(argv[++i], 0u, std::numeric_limits<unsigned>::max(), options.graine))
+                return false;
+        }
+        else if ((arg == "-m" || arg == "--moteur") && valeur)
+        {
+            std::string moteur = argv[++i];
+            if (moteur == "insertion")
+                options.moteur = MoteurDelaunay::Insertion;
+            else if (moteur == "division")
+                options.moteur = MoteurDelaunay::Division;
+            else
+                return false;
+        }
+        else if (arg == "--ordre" && valeur)
+        {
+            std::string ordre = argv[++i];
+            if (ordre == "lignes")
+                options.ordre = OrdreInsertion::Lignes;
+            else if (ordre == "hilbert")
+                options.ordre = OrdreInsertion::Hilbert;
+            else if (ordre == "brio")
+                options.ordre = OrdreInsertion::BRIO;
+            else
+                return false;
+        }
+        else if (arg[0] != '-' && options.entree.empty())
+            options.entree = arg;
+        else
+            return false;
+    }
+    return !options.entree.empty();
+}
+
+// Lit un nombre dans le type des coordonnées et avance le curseur ; retourne false à la fin du texte
+// ou si le nombre ne tient pas dans le type (horsPlage est alors vrai) : strtoll et strtod le signalent
+// par ERANGE en renvoyant une valeur bornée, qu'il ne faut pas prendre pour une coordonnée
+// (strtod met aussi ERANGE pour un nombre trop petit, arrondi vers 0, qui reste une coordonnée valide)
+template <typename T>
+static bool litNombre(const char*& curseur, T& valeur, bool& horsPlage)
+{
+    char* fin;
+    errno = 0;
+    if constexpr (std::is_integral<T>::value)
+    {
+        long long lu = std::strtoll(curseur, &fin, 10);
+        if (fin != curseur && (errno == ERANGE || lu < std::numeric_limits<T>::min() || lu > std::numeric_limits<T>::max()))
+        {
+            horsPlage = true;
+            return false;
+        }
+        valeur = lu;
+    }
+    else
+    {
+        // Un float est lu directement : un double trop grand pour lui ne peut pas être converti
+        if constexpr (std::is_same<T, float>::value)
+            valeur = std::strtof(curseur, &fin);
+        else
+            valeur = std::strtod(curseur, &fin);
+        if (fin != curseur && errno == ERANGE && std::isinf(valeur))
+        {
+            horsPlage = true;
+            return false;
+        }
+    }
+
+    if (fin == curseur)
+        return false;
+    curseur = fin;
+    return true;
+}
+
+// Lit les points d'un fichier ; horsPlage est vrai si la lecture s'est arrêtée sur une coordonnée
+// trop grande pour le type
+template <typename T>
+static bool litPoints(const std::string& chemin, std::vector<Point<T>>& points, bool& horsPlage)
+{
+    horsPlage = false;
+    std::ifstream fichier(chemin, std::ios::binary);
+    if (!fichier)
+        return false;
+
+    // On charge le fichier d'un coup puis on découpe les nombres à la main
+    std::stringstream tampon;
+    tampon << fichier.rdbuf();
+    const std::string texte = tampon.str();
+
+    const char* curseur = texte.c_str();
+    while (*curseur != '\0')
+    {
+        // On saute les blancs et les commentaires
+        if (*curseur == '#')
+        {
+            while (*curseur != '\0' && *curseur != '\n')
+                curseur++;
+            continue;
+        }
+        if (std::isspace((unsigned char)*curseur))
+        {
+            curseur++;
+            continue;
+        }
+
+        Point<T> P;
+        if (!litNombre(curseur, P.x, horsPlage) || !litNombre(curseur, P.y, horsPlage))
+            return false;
+        points.push_back(P);
+    }
+    return true;
+}
+
+template <typename T>
+static bool ecritResultat(const std::string& chemin, const BasicMesh<T>& mesh, const std::vector<Cellule>& cellules)
+{
+    std::ofstream fichier(chemin);
+    if (!fichier)
+        return false;
+    fichier.precision(17);
+
+    // Triangles : indices des trois sommets dans le fichier d'entrée
+    size_t nombre = 0;
+    for (const Triangle& t : mesh.triangles)
+        nombre += t.vivant;
+    fichier << "triangles " << nombre << "\n";
+    for (const Triangle& t : mesh.triangles)
+    {
+        if (t.vivant)
+            fichier << t.v[0] << " " << t.v[1] << " " << t.v[2] << "\n";
+    }
+
+    // Cellules : indice du site, nombre de sommets puis leurs coordonnées
+    fichier << "cellules " << cellules.size() << "\n";
+    for (const Cellule& cellule : cellules)
+    {
+        fichier << cellule.site << " " << cellule.sommets.size();
+        for (const SommetVoronoi& P : cellule.sommets)
+            fichier << " " << P.x << " " << P.y;
+        fichier << "\n";
+    }
+    return (bool)fichier;
+}
+
+// Pic de mémoire résidente du processus, en kilo-octets (-1 si on ne sait pas le mesurer)
+static long picMemoire()
+{
+#if defined(__APPLE__)
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024;
+#elif defined(__unix__)
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return -1;
+#endif
+}
+
+// Chronomètre des étapes, affichées au fur et à mesure
+struct Chrono
+{
+    std::chrono::steady_clock::time_point debut = std::chrono::steady_clock::now();
+
+    double etape(const char* nom)
+    {
+        auto maintenant = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(maintenant - debut).count();
+        std::printf("%-14s %10.3f ms\n", nom, ms);
+        debut = maintenant;
+        return ms;
+    }
+};
+
+template <typename T>
+static int execute(const Options& options)
+{
+    Chrono chrono;
+    double total = 0;
+
+    std::vector<Point<T>> points;
+    bool horsPlage;
+    if (!litPoints(options.entree, points, horsPlage))
+    {
+        if (horsPlage)
+            std::fprintf(stderr, "Des points sortent de la plage de coordonnees supportee\n");
+        else
+            std::fprintf(stderr, "Impossible de lire les points de %s\n", options.entree.c_str());
+        return 1;
+    }
+    total += chrono.etape("lecture");
+
+    // La construction passe par la bibliothèque, comme pour le visualiseur : on ne fait que la chronométrer
+    BasicMesh<T> mesh;
+    TempsParallele phases;
+    const bool bandes = options.moteur == MoteurDelaunay::Insertion && options.threads != 1;
+    if (!construitMaillage(mesh, points, options.ordre, false, options.graine, options.threads, options.moteur, &phases))
+    {
+        std::fprintf(stderr, "Des points sortent de la plage de coordonnees supportee\n");
+        return 1;
+    }
+    double delaunay = chrono.etape("delaunay");
+    total += delaunay;
+    if (bandes)
+    {
+        std::printf("  %-12s %10.3f ms\n", "decoupe", phases.decoupe);
+        std::printf("  %-12s %10.3f ms\n", "bandes", phases.bandes);
+        std::printf("  %-12s %10.3f ms\n", "couture", phases.couture);
+        std::printf("  %-12s %10.3f ms\n", "bascules", phases.bascules);
+    }
+
+    std::vector<Cellule> cellules;
+    construitCellules(mesh, cellules, options.threads);
+    double voronoi = chrono.etape("voronoi");
+    total += voronoi;
+
+    if (!options.sortie.empty())
+    {
+        if (!ecritResultat(options.sortie, mesh, cellules))
+        {
+            std::fprintf(stderr, "Impossible d'ecrire %s\n", options.sortie.c_str());
+            return 1;
+        }
+        total += chrono.etape("ecriture");
+    }
+
+    size_t triangles = 0;
+    for (const Triangle& t : mesh.triangles)
+        triangles += t.vivant;
+
+    std::printf("%-14s %10.3f ms\n", "total", total);
+    std::printf("points         %10zu\n", points.size());
+    std::printf("triangles      %10zu\n", triangles);
+    std::printf("cellules       %10zu\n", cellules.size());
+    std::printf("debit          %10.0f points/s (delaunay + voronoi)\n", points.size() / ((delaunay + voronoi) / 1000.0));
+    std::printf("memoire max    %10ld ko\n", picMemoire());
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!litOptions(argc, argv, options))
+    {
+        usage();
+        return 2;
+    }
+
+    if (options.type == "int")
+        return execute<int>(options);
+#ifdef __SIZEOF_INT128__
+    if (options.type == "int64")
+        return execute<std::int64_t>(options);
+#endif
+    if (options.type == "float")
+        return execute<float>(options);
+    if (options.type == "double")
+        return execute<double>(options);
+
+    std::fprintf(stderr, "Type de coordonnees inconnu : %s\n", options.type.c_str());
+    return 2;
+}
@@ -0,0 +1,1708 @@
+#include "delaunay.h"
+#include "insertion_order.h"
+#include "parallele.h"
+#include "predicates.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+// Le noyau de prédicats est choisi à la compilation d'après le type des coordonnées :
+// chaque fonction ci-dessous utilise Predicats<Scalaire>, sans aucun appel virtuel
+
+// Calcule le cercle circonscrit du triangle t et le range dans la table des cercles
+template <typename Scalaire>
+static void calculeCercle(BasicMesh<Scalaire>& mesh, int t)
+{
+    const Triangle& T = mesh.triangles[t];
+
+    // Un triangle infini n'a pas de cercle : la marge infinie renvoie toujours au prédicat exact
+    if (!T.fini())
+    {
+        mesh.cercles[t] = {0, 0, 0, std::numeric_limits<double>::infinity()};
+        return;
+    }
+
+    const Point<Scalaire>& a = mesh.sommet(T.v[0]);
+    const Point<Scalaire>& b = mesh.sommet(T.v[1]);
+    const Point<Scalaire>& c = mesh.sommet(T.v[2]);
+
+    // On se place en a pour garder des nombres petits
+    double bx = (double)b.x - a.x, by = (double)b.y - a.y;
+    double cx = (double)c.x - a.x, cy = (double)c.y - a.y;
+    double lb = bx * bx + by * by;
+    double lc = cx * cx + cy * cy;
+    double d = 2.0 * (bx * cy - by * cx);
+    double inverse = 1.0 / d;
+
+    double ux = (cy * lb - by * lc) * inverse;
+    double uy = (bx * lc - cx * lb) * inverse;
+    double rayon2 = ux * ux + uy * uy;
+
+    // Pour un triangle bien formé, l'erreur d'arrondi sur le centre est négligeable
+    // devant la marge ; pour un triangle trop aplati on se fiera toujours au prédicat exact
+    // Le centre est arrondi à l'échelle des coordonnées : loin de l'origine (grandes
+    // coordonnées 64 bits ou flottantes), la marge doit grandir avec elles
+    double marge = std::numeric_limits<double>::infinity();
+    if (std::fabs(d) > 1e-3 * (lb + lc))
+    {
+        double echelle = std::max(std::fabs((double)a.x), std::fabs((double)a.y));
+        marge = 2e-6 * rayon2 + 5e-19 * echelle * echelle;
+    }
+
+    mesh.cercles[t] = {a.x + ux, a.y + uy, rayon2, marge};
+}
+
+template <typename Scalaire>
+int BasicMesh<Scalaire>::ajouteTriangle(int a, int b, int c)
+{
+    Triangle t;
+    t.v[0] = a;
+    t.v[1] = b;
+    t.v[2] = c;
+    t.voisins[0] = t.voisins[1] = t.voisins[2] = -1;
+
+    // On réutilise une case libre s'il y en a une
+    int index;
+    if (!libres.empty())
+    {
+        index = libres.back();
+        libres.pop_back();
+        triangles[index] = t;
+    }
+    else
+    {
+        index = triangles.size();
+        triangles.push_back(t);
+        cercles.push_back(Cercle());
+    }
+
+    // Le nouveau triangle devient le triangle incident de ses sommets
+    if (incident.size() < sommets.size())
+        incident.resize(sommets.size(), -1);
+    for (int v : t.v)
+    {
+        if (v != INFINI)
+            incident[v] = index;
+    }
+
+    calculeCercle(*this, index);
+    return index;
+}
+
+template <typename Scalaire>
+void BasicMesh<Scalaire>::retireTriangle(int t)
+{
+    triangles[t].vivant = false;
+    libres.push_back(t);
+}
+
+template <typename Scalaire>
+void BasicMesh<Scalaire>::clear()
+{
+    sommets.clear();
+    triangles.clear();
+    libres.clear();
+    cercles.clear();
+    incident.clear();
+    jumeaux.clear();
+    dernier = -1;
+    stats = Statistiques();
+}
+
+template <typename Scalaire>
+void BasicMesh<Scalaire>::ajouteJumeau(int v, int s)
+{
+    // s peut amener son propre cycle (un point qui remplace un sommet déplacé garde les autres points
+    // confondus avec lui) : on raccorde les deux cycles en échangeant les suivants de v et de s,
+    // un point seul étant son propre suivant
+    const int apresV = jumeaux[v] == -1 ? v : jumeaux[v];
+    const int apresS = jumeaux[s] == -1 ? s : jumeaux[s];
+    jumeaux[v] = apresS;
+    jumeaux[s] = apresV;
+}
+
+template <typename Scalaire>
+int BasicMesh<Scalaire>::detacheJumeau(int s)
+{
+    if (jumeaux[s] == -1)
+        return -1;
+
+    // On fait le tour du cycle pour trouver le précédent de s et le plus petit des autres indices
+    int precedent = s, plusPetit = jumeaux[s];
+    while (jumeaux[precedent] != s)
+    {
+        precedent = jumeaux[precedent];
+        plusPetit = std::min(plusPetit, precedent);
+    }
+
+    if (jumeaux[s] == precedent)
+        jumeaux[precedent] = -1;
+    else
+        jumeaux[precedent] = jumeaux[s];
+    jumeaux[s] = -1;
+    return plusPetit;
+}
+
+template <typename Scalaire>
+int localiseTriangle(const BasicMesh<Scalaire>& mesh, const Point<Scalaire>& P, int depart)
+{
+    typedef Predicats<Scalaire> Noyau;
+
+    int t = depart;
+    int premier = 0;
+
+    // On part d'un triangle fini
+    if (t != -1 && !mesh.triangles[t].fini())
+    {
+        const Triangle& T = mesh.triangles[t];
+        for (int i=0; i < 3; i++)
+        {
+            if (T.v[i] == INFINI)
+                t = T.voisins[i];
+        }
+    }
+
+    // On avance tant que P est de l'autre côté d'une arête du triangle courant
+    // (on change d'arête de départ à chaque pas pour ne pas tourner en rond)
+    while (t != -1)
+    {
+        const Triangle& T = mesh.triangles[t];
+
+        // On est sorti de l'enveloppe convexe par l'arête finie de ce triangle
+        if (!T.fini())
+            return t;
+
+        int suivant = t;
+        for (int k=0; k < 3; k++)
+        {
+            int i = (premier + k) % 3;
+            const Point<Scalaire>& a = mesh.sommet(T.v[(i + 1) % 3]);
+            const Point<Scalaire>& b = mesh.sommet(T.v[(i + 2) % 3]);
+            if (Noyau::orient(a.x, a.y, b.x, b.y, P.x, P.y) < 0)
+            {
+                suivant = T.voisins[i];
+                break;
+            }
+        }
+
+        // P n'est derrière aucune arête : on l'a trouvé
+        if (suivant == t)
+            return t;
+
+        t = suivant;
+        premier = (premier + 1) % 3;
+    }
+
+    return -1;
+}
+
+// Vérifie si P est strictement entre a et b, sachant que les trois points sont alignés
+template <typename Scalaire>
+static bool entre(const Point<Scalaire>& a, const Point<Scalaire>& b, const Point<Scalaire>& P)
+{
+    if (a.x != b.x)
+        return (a.x < P.x && P.x < b.x) || (b.x < P.x && P.x < a.x);
+    return (a.y < P.y && P.y < b.y) || (b.y < P.y && P.y < a.y);
+}
+
+// Vérifie si le cercle circonscrit du triangle t contient le point P
+template <typename Scalaire>
+static bool dansCercle(BasicMesh<Scalaire>& mesh, int t, const Point<Scalaire>& P)
+{
+    typedef Predicats<Scalaire> Noyau;
+    mesh.stats.testsCercle++;
+
+    // On regarde d'abord le cercle déjà calculé : loin du bord, il suffit à conclure
+    const Cercle& C = mesh.cercles[t];
+    double dx = (double)P.x - C.x;
+    double dy = (double)P.y - C.y;
+    double ecart = dx * dx + dy * dy - C.rayon2;
+    if (ecart > C.marge)
+        return false;
+    if (ecart < -C.marge)
+        return true;
+    mesh.stats.testsExacts++;
+
+    const Triangle& T = mesh.triangles[t];
+
+    // Le « cercle » d'un triangle infini est le demi-plan situé de l'autre côté de son arête finie
+    // (arête comprise, extrémités exclues, pour que l'enveloppe convexe suive les points alignés)
+    if (!T.fini())
+    {
+        int k = T.v[0] == INFINI ? 0 : (T.v[1] == INFINI ? 1 : 2);
+        const Point<Scalaire>& a = mesh.sommet(T.v[(k + 1) % 3]);
+        const Point<Scalaire>& b = mesh.sommet(T.v[(k + 2) % 3]);
+        auto o = Noyau::orient(a.x, a.y, b.x, b.y, P.x, P.y);
+        if (o != 0)
+            return o > 0;
+        return entre(a, b, P);
+    }
+
+    // Sinon on tranche avec le prédicat exact
+    const Point<Scalaire>& p1 = mesh.sommet(T.v[0]);
+    const Point<Scalaire>& p2 = mesh.sommet(T.v[1]);
+    const Point<Scalaire>& p3 = mesh.sommet(T.v[2]);
+
+    return Noyau::dansCercle(p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, P.x, P.y) > 0;
+}
+
+template <typename Scalaire>
+bool insereSommet(BasicMesh<Scalaire>& mesh, int s)
+{
+    typedef Predicats<Scalaire> Noyau;
+    const Point<Scalaire> P = mesh.sommets[s];
+
+    // On part du dernier triangle créé pour trouver celui qui contient P
+    int depart = mesh.dernier;
+    if (depart == -1 || !mesh.triangles[depart].vivant)
+    {
+        depart = 0;
+        while (depart < (int)mesh.triangles.size() && !mesh.triangles[depart].vivant)
+            depart++;
+        if (depart == (int)mesh.triangles.size())
+            return false;
+    }
+
+    // Si les triangles infinis ont été retirés, on ne peut rien insérer hors de l'enveloppe
+    int germe = localiseTriangle(mesh, P, depart);
+    if (germe == -1)
+        return false;
+
+    // Un point confondu avec un sommet existant n'est pas inséré : on le note parmi ses jumeaux
+    for (int i=0; i < 3; i++)
+    {
+        int v = mesh.triangles[germe].v[i];
+        if (v != INFINI && mesh.sommets[v] == P)
+        {
+            mesh.ajouteJumeau(v, s);
+            return false;
+        }
+    }
+
+    // On parcourt les voisins de proche en proche depuis le triangle trouvé :
+    // seuls les triangles dont le cercle circonscrit contient P font partie de la cavité
+    // (ils sont marqués comme supprimés, leur case ne sera libérée qu'après avoir lu le bord)
+    std::vector<int>& cavite = mesh.cavite;
+    cavite.clear();
+    mesh.triangles[germe].vivant = false;
+    cavite.push_back(germe);
+    for (size_t k=0; k < cavite.size(); k++)
+    {
+        const Triangle& T = mesh.triangles[cavite[k]];
+        for (int i=0; i < 3; i++)
+        {
+            int n = T.voisins[i];
+            if (n != -1 && mesh.triangles[n].vivant && dansCercle(mesh, n, P))
+            {
+                mesh.triangles[n].vivant = false;
+                cavite.push_back(n);
+            }
+        }
+    }
+
+    // Le bord de la cavité est formé des arêtes dont le voisin n'a pas été supprimé
+    std::vector<AreteBord>& bord = mesh.bord;
+    bord.clear();
+    for (int t : cavite)
+    {
+        const Triangle& T = mesh.triangles[t];
+        for (int i=0; i < 3; i++)
+        {
+            int n = T.voisins[i];
+            if (n == -1)
+            {
+                bord.push_back({T.v[(i + 1) % 3], T.v[(i + 2) % 3], -1, -1, -1});
+            }
+            else if (mesh.triangles[n].vivant)
+            {
+                // On retient l'arête côté extérieur avant que les cases ne soient réutilisées
+                const Triangle& E = mesh.triangles[n];
+                int cote = 0;
+                while (E.voisins[cote] != t)
+                    cote++;
+                bord.push_back({T.v[(i + 1) % 3], T.v[(i + 2) % 3], n, cote, -1});
+            }
+        }
+    }
+
+    // Sans triangles infinis, un point posé sur une arête de l'enveloppe ferait avec elle un triangle plat :
+    // on le refuse comme un point hors de l'enveloppe, avant d'avoir touché au maillage
+    for (const AreteBord& A : bord)
+    {
+        if (A.exterieur != -1 || A.a == INFINI || A.b == INFINI)
+            continue;
+        const Point<Scalaire>& a = mesh.sommet(A.a);
+        const Point<Scalaire>& b = mesh.sommet(A.b);
+        if (Noyau::orient(a.x, a.y, b.x, b.y, P.x, P.y) <= 0)
+        {
+            for (int t : cavite)
+                mesh.triangles[t].vivant = true;
+            return false;
+        }
+    }
+
+    for (int t : cavite)
+        mesh.retireTriangle(t);
+
+    // On créé un nouveau triangle pour chaque arête du bord et le point P
+    for (AreteBord& A : bord)
+    {
+        int t = mesh.ajouteTriangle(A.a, A.b, s);
+        A.nouveau = t;
+
+        // Le triangle extérieur pointe maintenant vers le nouveau triangle
+        mesh.triangles[t].voisins[2] = A.exterieur;
+        if (A.exterieur != -1)
+            mesh.triangles[A.exterieur].voisins[A.cote] = t;
+    }
+
+    // On relie les nouveaux triangles entre eux autour de P : le bord est un cycle où chaque
+    // sommet est une seule fois le début d'une arête, on range donc les triangles par premier sommet
+    // dans une petite table à adressage ouvert
+    size_t taille = 8;
+    while (taille < 2 * bord.size())
+        taille *= 2;
+    const unsigned masque = taille - 1;
+    std::vector<CaseArete>& table = mesh.table;
+    table.assign(taille, {0, -1});
+
+    for (const AreteBord& A : bord)
+    {
+        unsigned h = ((unsigned)A.a * 2654435761u) & masque;
+        while (table[h].triangle != -1)
+            h = (h + 1) & masque;
+        table[h] = {A.a, A.nouveau};
+    }
+
+    // Le triangle (a, b, P) partage l'arête (b, P) avec le triangle qui commence en b
+    for (const AreteBord& A : bord)
+    {
+        unsigned h = ((unsigned)A.b * 2654435761u) & masque;
+        while (table[h].sommet != A.b)
+            h = (h + 1) & masque;
+
+        int u = table[h].triangle;
+        mesh.triangles[A.nouveau].voisins[0] = u;
+        mesh.triangles[u].voisins[1] = A.nouveau;
+    }
+
+    mesh.dernier = bord.back().nouveau;
+    return true;
+}
+
+// Place le sommet s (déjà rangé dans mesh.sommets) dans la triangulation et note les sites touchés
+template <typename Scalaire>
+static bool placeSommet(BasicMesh<Scalaire>& mesh, int s, std::vector<int>& modifies)
+{
+    // Tant que tous les points sont alignés le maillage est vide : on retente la construction
+    // complète, qui ne coûte qu'un parcours des points dans ce cas
+    if (mesh.triangles.size() == mesh.libres.size())
+    {
+        std::vector<Point<Scalaire>> points = mesh.sommets;
+        std::vector<int> retires, ordre;
+        for (size_t v=0; v < points.size(); v++)
+        {
+            if (mesh.incident[v] == RETIRE)
+                retires.push_back(v);
+            else
+                ordre.push_back(v);
+        }
+        trianguleDelaunay(mesh, points, ordre);
+        for (int v : retires)
+            mesh.incident[v] = RETIRE;
+
+        for (size_t v=0; v < mesh.incident.size(); v++)
+        {
+            if (mesh.incident[v] >= 0)
+                modifies.push_back(v);
+        }
+        return mesh.incident[s] >= 0;
+    }
+
+    if (!insereSommet(mesh, s))
+        return false;
+
+    // Le bord de la cavité forme un cycle : chaque sommet du bord en est une fois le début
+    modifies.push_back(s);
+    for (const AreteBord& A : mesh.bord)
+    {
+        if (A.a != INFINI)
+            modifies.push_back(A.a);
+    }
+    return true;
+}
+
+template <typename Scalaire>
+bool ajoutePoint(BasicMesh<Scalaire>& mesh, const Point<Scalaire>& P, std::vector<int>& modifies)
+{
+    typedef Predicats<Scalaire> Noyau;
+    modifies.clear();
+
+    const int s = mesh.sommets.size();
+    mesh.sommets.push_back(P);
+    mesh.incident.resize(mesh.sommets.size(), -1);
+    mesh.jumeaux.resize(mesh.sommets.size(), -1);
+    if (!Noyau::dansLimites(P.x, P.y))
+        return false;
+
+    return placeSommet(mesh, s, modifies);
+}
+
+// Indice, dans le triangle T, du sommet opposé à l'arête (a, b)
+static int oppose(const Triangle& T, int a, int b)
+{
+    int k = 0;
+    while (T.v[k] == a || T.v[k] == b)
+        k++;
+    return k;
+}
+
+// Le triangle t a pour voisin nouveau de l'autre côté de son arête (a, b)
+// (on repère l'arête par ses sommets : deux triangles infinis peuvent partager deux arêtes)
+template <typename Scalaire>
+static void changeVoisin(BasicMesh<Scalaire>& mesh, int t, int a, int b, int nouveau)
+{
+    if (t != -1)
+        mesh.triangles[t].voisins[oppose(mesh.triangles[t], a, b)] = nouveau;
+}
+
+// Donne de nouveaux sommets au triangle t, qui devient leur triangle incident, et recalcule son cercle
+template <typename Scalaire>
+static void metSommets(BasicMesh<Scalaire>& mesh, int t, int a, int b, int c)
+{
+    Triangle& T = mesh.triangles[t];
+    T.v[0] = a;
+    T.v[1] = b;
+    T.v[2] = c;
+    for (int v : T.v)
+    {
+        if (v != INFINI)
+            mesh.incident[v] = t;
+    }
+    calculeCercle(mesh, t);
+}
+
+// Bascule l'arête opposée au sommet i du triangle t : les triangles (a, b, c) et (d, c, b) qui
+// la partagent deviennent (a, b, d) et (d, c, a), sans changer d'indice ; retourne l'autre triangle
+// Le quadrilatère (a, b, d, c) doit être strictement convexe (ou avoir un sommet infini qui le permet)
+template <typename Scalaire>
+static int bascule(BasicMesh<Scalaire>& mesh, int t, int i)
+{
+    Triangle& T = mesh.triangles[t];
+    const int a = T.v[i], b = T.v[(i + 1) % 3], c = T.v[(i + 2) % 3];
+    const int u = T.voisins[i];
+    const int tca = T.voisins[(i + 1) % 3];
+    const int tab = T.voisins[(i + 2) % 3];
+
+    Triangle& U = mesh.triangles[u];
+    const int j = oppose(U, b, c);
+    const int d = U.v[j];
+    const int ubd = U.voisins[(j + 1) % 3];
+    const int udc = U.voisins[(j + 2) % 3];
+
+    metSommets(mesh, t, a, b, d);
+    T.voisins[0] = ubd;
+    T.voisins[1] = u;
+    T.voisins[2] = tab;
+
+    metSommets(mesh, u, d, c, a);
+    U.voisins[0] = tca;
+    U.voisins[1] = t;
+    U.voisins[2] = udc;
+
+    changeVoisin(mesh, ubd, b, d, t);
+    changeVoisin(mesh, tca, c, a, u);
+    return u;
+}
+
+// Algorithme de Lawson : on bascule les arêtes qui ne respectent plus la propriété du cercle vide,
+// en partant des triangles de mesh.pile, jusqu'à ce que toutes leurs arêtes soient localement de Delaunay
+// Les arêtes de l'enveloppe convexe (bordées par un triangle infini ou sans voisin) ne basculent jamais
+// Retourne false si l'on s'arrête après limite bascules : le maillage reste une triangulation valide,
+// mais pas forcément de Delaunay
+template <typename Scalaire>
+static bool restaureDelaunay(BasicMesh<Scalaire>& mesh, std::vector<int>& modifies, size_t limite = std::numeric_limits<size_t>::max())
+{
+    std::vector<int>& pile = mesh.pile;
+    size_t bascules = 0;
+    while (!pile.empty())
+    {
+        const int t = pile.back();
+        pile.pop_back();
+
+        const Triangle& T = mesh.triangles[t];
+        if (!T.vivant || !T.fini())
+            continue;
+
+        for (int i=0; i < 3; i++)
+        {
+            const int n = T.voisins[i];
+            if (n == -1 || !mesh.triangles[n].fini())
+                continue;
+
+            const Triangle& N = mesh.triangles[n];
+            const int j = oppose(N, T.v[(i + 1) % 3], T.v[(i + 2) % 3]);
+
+            // Le sommet d'en face est dans le cercle : l'arête n'est pas de Delaunay
+            if (dansCercle(mesh, t, mesh.sommet(N.v[j])))
+            {
+                modifies.push_back(N.v[j]);
+                for (int v : T.v)
+                    modifies.push_back(v);
+
+                bascule(mesh, t, i);
+                pile.push_back(t);
+                pile.push_back(n);
+                if (++bascules > limite)
+                    return false;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+// Retire les doublons d'une liste d'indices de sommets ou de triangles, sans la trier : on marque
+// chaque indice vu puis on efface les marques, pour un coût proportionnel à la longueur de la liste
+template <typename Scalaire>
+static void dedoublonne(BasicMesh<Scalaire>& mesh, std::vector<int>& indices)
+{
+    std::vector<char>& vus = mesh.vus;
+    vus.resize(std::max(mesh.sommets.size(), mesh.triangles.size()), 0);
+
+    size_t k = 0;
+    for (int i : indices)
+    {
+        if (!vus[i])
+        {
+            vus[i] = 1;
+            indices[k++] = i;
+        }
+    }
+    indices.resize(k);
+    for (int i : indices)
+        vus[i] = 0;
+}
+
+// Tourne autour du sommet s : etoile reçoit les triangles (s, lien[j], lien[j + 1]) dans le sens direct
+// Retourne false si on rencontre une arête sans voisin (triangles infinis retirés)
+template <typename Scalaire>
+static bool tourneAutour(const BasicMesh<Scalaire>& mesh, int s, std::vector<int>& etoile, std::vector<int>& lien)
+{
+    etoile.clear();
+    lien.clear();
+
+    const int depart = mesh.incident[s];
+    int t = depart;
+    do
+    {
+        const Triangle& T = mesh.triangles[t];
+        int i = T.v[0] == s ? 0 : (T.v[1] == s ? 1 : 2);
+        etoile.push_back(t);
+        lien.push_back(T.v[(i + 1) % 3]);
+
+        t = T.voisins[(i + 1) % 3];
+        if (t == -1)
+            return false;
+    } while (t != depart);
+
+    return true;
+}
+
+// Vérifie si w est dans le triangle (p, q, r) pris dans le sens direct, bord compris
+template <typename Scalaire>
+static bool dansTriangle(const Point<Scalaire>& p, const Point<Scalaire>& q, const Point<Scalaire>& r, const Point<Scalaire>& w)
+{
+    typedef Predicats<Scalaire> Noyau;
+    return Noyau::orient(p.x, p.y, q.x, q.y, w.x, w.y) >= 0
+        && Noyau::orient(q.x, q.y, r.x, r.y, w.x, w.y) >= 0
+        && Noyau::orient(r.x, r.y, p.x, p.y, w.x, w.y) >= 0;
+}
+
+// Retire un sommet intérieur : on supprime ses triangles et on triangule le polygone formé par
+// ses voisins en coupant des oreilles, de préférence celles dont le cercle ne contient aucun autre
+// sommet du polygone, qui sont déjà des triangles de Delaunay
+template <typename Scalaire>
+static void retireSommetInterieur(BasicMesh<Scalaire>& mesh, int s, std::vector<int>& etoile, std::vector<int>& lien)
+{
+    typedef Predicats<Scalaire> Noyau;
+
+    // exterieurs[j] est le triangle de l'autre côté de l'arête (lien[j], lien[j + 1]) du polygone
+    std::vector<int> exterieurs(etoile.size());
+    for (size_t j=0; j < etoile.size(); j++)
+    {
+        const Triangle& T = mesh.triangles[etoile[j]];
+        int i = T.v[0] == s ? 0 : (T.v[1] == s ? 1 : 2);
+        exterieurs[j] = T.voisins[i];
+        mesh.retireTriangle(etoile[j]);
+    }
+
+    while (lien.size() > 3)
+    {
+        // Une oreille (p, q, r) est valide si q est un sommet saillant et si aucun autre sommet du
+        // polygone n'est dans le triangle ; il y en a toujours une, et toujours une de Delaunay
+        const int d = lien.size();
+        int choisi = -1;
+        for (int i=0; i < d; i++)
+        {
+            const Point<Scalaire>& p = mesh.sommet(lien[(i + d - 1) % d]);
+            const Point<Scalaire>& q = mesh.sommet(lien[i]);
+            const Point<Scalaire>& r = mesh.sommet(lien[(i + 1) % d]);
+            if (Noyau::orient(p.x, p.y, q.x, q.y, r.x, r.y) <= 0)
+                continue;
+
+            bool valide = true, vide = true;
+            for (int k=2; k < d - 1 && valide; k++)
+            {
+                const Point<Scalaire>& w = mesh.sommet(lien[(i + k) % d]);
+                valide = !dansTriangle(p, q, r, w);
+                vide = vide && Noyau::dansCercle(p.x, p.y, q.x, q.y, r.x, r.y, w.x, w.y) <= 0;
+            }
+            if (valide && choisi == -1)
+                choisi = i;
+            if (valide && vide)
+            {
+                choisi = i;
+                break;
+            }
+        }
+
+        // On coupe l'oreille : l'arête (p, r) la sépare du reste du polygone
+        const int i = choisi, avant = (i + d - 1) % d;
+        const int p = lien[avant], q = lien[i], r = lien[(i + 1) % d];
+        const int t = mesh.ajouteTriangle(p, q, r);
+        Triangle& T = mesh.triangles[t];
+        T.voisins[0] = exterieurs[i];
+        T.voisins[2] = exterieurs[avant];
+        changeVoisin(mesh, exterieurs[i], q, r, t);
+        changeVoisin(mesh, exterieurs[avant], p, q, t);
+        mesh.pile.push_back(t);
+
+        exterieurs[avant] = t;
+        exterieurs.erase(exterieurs.begin() + i);
+        lien.erase(lien.begin() + i);
+    }
+
+    // Il reste un triangle
+    const int t = mesh.ajouteTriangle(lien[0], lien[1], lien[2]);
+    Triangle& T = mesh.triangles[t];
+    T.voisins[0] = exterieurs[1];
+    T.voisins[1] = exterieurs[2];
+    T.voisins[2] = exterieurs[0];
+    changeVoisin(mesh, exterieurs[0], lien[0], lien[1], t);
+    changeVoisin(mesh, exterieurs[1], lien[1], lien[2], t);
+    changeVoisin(mesh, exterieurs[2], lien[2], lien[0], t);
+    mesh.pile.push_back(t);
+}
+
+// Retire un sommet de l'enveloppe convexe : ses triangles finis deviennent des triangles infinis
+// sur la chaîne de ses voisins, puis on rend l'enveloppe à nouveau convexe comme dans le parcours
+// de Graham, en basculant les arêtes infinies aux sommets rentrants
+// Retourne false si les points restants sont tous alignés
+template <typename Scalaire>
+static bool retireSommetEnveloppe(BasicMesh<Scalaire>& mesh, int s, std::vector<int>& etoile, std::vector<int>& lien)
+{
+    typedef Predicats<Scalaire> Noyau;
+
+    // On range le lien pour que le sommet infini soit à la fin : v0, ..., vk, INFINI
+    const int d = lien.size();
+    const int p = std::find(lien.begin(), lien.end(), INFINI) - lien.begin();
+    std::rotate(lien.begin(), lien.begin() + (p + 1) % d, lien.end());
+    std::rotate(etoile.begin(), etoile.begin() + (p + 1) % d, etoile.end());
+    const int k = d - 2;
+
+    // Les deux triangles infinis de s disparaissent ; leurs voisins de l'autre côté bordent la chaîne
+    const int avant = etoile[d - 1], apres = etoile[d - 2];
+    int exterieurs[2];
+    for (int j=0; j < 2; j++)
+    {
+        const Triangle& G = mesh.triangles[j == 0 ? avant : apres];
+        int i = G.v[0] == s ? 0 : (G.v[1] == s ? 1 : 2);
+        exterieurs[j] = G.voisins[i];
+    }
+
+    // Chaque triangle fini (s, vj, vj+1) devient le triangle infini de l'arête (vj, vj+1)
+    for (int j=0; j < k; j++)
+    {
+        const Triangle& T = mesh.triangles[etoile[j]];
+        int i = T.v[0] == s ? 0 : (T.v[1] == s ? 1 : 2);
+        int v[3] = {T.v[0], T.v[1], T.v[2]};
+        v[i] = INFINI;
+        metSommets(mesh, etoile[j], v[0], v[1], v[2]);
+    }
+    changeVoisin(mesh, etoile[0], INFINI, lien[0], exterieurs[0]);
+    changeVoisin(mesh, exterieurs[0], INFINI, lien[0], etoile[0]);
+    changeVoisin(mesh, etoile[k - 1], lien[k], INFINI, exterieurs[1]);
+    changeVoisin(mesh, exterieurs[1], lien[k], INFINI, etoile[k - 1]);
+    mesh.retireTriangle(avant);
+    mesh.retireTriangle(apres);
+
+    // Parcours de Graham le long de la chaîne : l'intérieur est à droite, un virage à gauche est rentrant
+    // On bascule alors l'arête infinie du sommet du milieu, ce qui ajoute le triangle fini (a, b, c)
+    std::vector<int>& chaine = mesh.cavite;
+    std::vector<int> infinis;
+    chaine.assign(1, lien[0]);
+    for (int j=1; j <= k; j++)
+    {
+        int g = etoile[j - 1];
+        const Point<Scalaire>& c = mesh.sommet(lien[j]);
+        while (chaine.size() >= 2)
+        {
+            const Point<Scalaire>& a = mesh.sommet(chaine[chaine.size() - 2]);
+            const Point<Scalaire>& b = mesh.sommet(chaine.back());
+            if (Noyau::orient(a.x, a.y, b.x, b.y, c.x, c.y) <= 0)
+                break;
+
+            const int f = infinis.back();
+            const Triangle& F = mesh.triangles[f];
+            int i = 0;
+            while (F.v[i] != chaine[chaine.size() - 2])
+                i++;
+            g = bascule(mesh, f, i);
+            mesh.pile.push_back(f);
+
+            chaine.pop_back();
+            infinis.pop_back();
+        }
+        chaine.push_back(lien[j]);
+        infinis.push_back(g);
+    }
+
+    // Une arête de la nouvelle enveloppe bordée des deux côtés par un triangle infini :
+    // tous les points restants sont sur une même droite
+    for (int g : infinis)
+    {
+        const Triangle& G = mesh.triangles[g];
+        int i = G.v[0] == INFINI ? 0 : (G.v[1] == INFINI ? 1 : 2);
+        if (!mesh.triangles[G.voisins[i]].fini())
+            return false;
+    }
+    return true;
+}
+
+// Vérifie si le point s est dans le maillage, ou dans le cycle d'un sommet du maillage
+template <typename Scalaire>
+static bool accueilli(const BasicMesh<Scalaire>& mesh, int s)
+{
+    int v = s;
+    do
+    {
+        if (mesh.incident[v] >= 0)
+            return true;
+        v = mesh.jumeaux[v];
+    } while (v != -1 && v != s);
+    return false;
+}
+
+// Insère à la place du sommet s, qui vient d'être retiré ou déplacé, le plus petit des points qui lui
+// étaient confondus ; les autres restent dans son cycle et le suivent, y compris quand un sommet arrivé
+// entre-temps à cette place l'accueille comme jumeau
+// Si la place n'est plus dans le maillage (sur le bord d'un maillage sans triangles infinis), aucun de
+// ces points ne peut y entrer : ils en restent tous dehors, chacun seul
+template <typename Scalaire>
+static void remplaceParJumeau(BasicMesh<Scalaire>& mesh, int s, std::vector<int>& modifies)
+{
+    int jumeau = mesh.detacheJumeau(s);
+    if (jumeau == -1 || placeSommet(mesh, jumeau, modifies) || accueilli(mesh, jumeau))
+        return;
+    while (jumeau != -1)
+        jumeau = mesh.detacheJumeau(jumeau);
+}
+
+template <typename Scalaire>
+bool retireSommet(BasicMesh<Scalaire>& mesh, int s, std::vector<int>& modifies)
+{
+    modifies.clear();
+    if (s < 0 || s >= (int)mesh.incident.size() || mesh.incident[s] == RETIRE)
+        return false;
+
+    // Un point confondu avec un sommet n'a rien à retirer du maillage : il ne prendra plus sa place
+    if (mesh.incident[s] == -1)
+    {
+        if (mesh.detacheJumeau(s) == -1)
+            return false;
+        mesh.incident[s] = RETIRE;
+        modifies.push_back(s);
+        return true;
+    }
+
+    std::vector<int> etoile, lien;
+    bool ferme = tourneAutour(mesh, s, etoile, lien);
+    bool surEnveloppe = std::find(lien.begin(), lien.end(), INFINI) != lien.end();
+
+    // Sans triangles infinis, on ne sait pas retirer un sommet de l'enveloppe
+    if (!ferme)
+        return false;
+
+    modifies.push_back(s);
+    for (int v : lien)
+    {
+        if (v != INFINI)
+            modifies.push_back(v);
+    }
+
+    mesh.pile.clear();
+    bool aligne = false;
+    if (!surEnveloppe)
+        retireSommetInterieur(mesh, s, etoile, lien);
+    else
+        aligne = !retireSommetEnveloppe(mesh, s, etoile, lien);
+    mesh.incident[s] = RETIRE;
+
+    if (aligne)
+    {
+        // Les points restants sont alignés : comme à la construction, le maillage reste vide
+        for (size_t v=0; v < mesh.incident.size(); v++)
+        {
+            if (mesh.incident[v] >= 0)
+            {
+                modifies.push_back(v);
+                mesh.incident[v] = -1;
+            }
+        }
+        // (les points confondus seront notés à nouveau par la prochaine construction)
+        mesh.triangles.clear();
+        mesh.libres.clear();
+        mesh.cercles.clear();
+        std::fill(mesh.jumeaux.begin(), mesh.jumeaux.end(), -1);
+        mesh.dernier = -1;
+        return true;
+    }
+
+    // Le trou est triangulé : Lawson rétablit la propriété du cercle vide
+    restaureDelaunay(mesh, modifies);
+    mesh.dernier = mesh.incident[lien[0] == INFINI ? lien[1] : lien[0]];
+    remplaceParJumeau(mesh, s, modifies);
+
+    dedoublonne(mesh, modifies);
+    return true;
+}
+
+// Vérifie si le sommet s peut aller en P sans changer la triangulation : tous ses triangles
+// doivent rester dans le sens direct (un sommet de l'enveloppe convexe ne le peut jamais)
+template <typename Scalaire>
+static bool resteDansEtoile(const BasicMesh<Scalaire>& mesh, int s, const Point<Scalaire>& P)
+{
+    typedef Predicats<Scalaire> Noyau;
+
+    const int depart = mesh.incident[s];
+    int t = depart;
+    do
+    {
+        const Triangle& T = mesh.triangles[t];
+        int i = T.v[0] == s ? 0 : (T.v[1] == s ? 1 : 2);
+        int a = T.v[(i + 1) % 3], b = T.v[(i + 2) % 3];
+        if (a == INFINI || b == INFINI)
+            return false;
+        if (Noyau::orient(P.x, P.y, mesh.sommet(a).x, mesh.sommet(a).y, mesh.sommet(b).x, mesh.sommet(b).y) <= 0)
+            return false;
+
+        t = T.voisins[(i + 1) % 3];
+        if (t == -1)
+            return false;
+    } while (t != depart);
+
+    return true;
+}
+
+// Empile les triangles du sommet s pour Lawson et note s et ses voisins comme touchés
+template <typename Scalaire>
+static void empileEtoile(BasicMesh<Scalaire>& mesh, int s, std::vector<int>& modifies)
+{
+    modifies.push_back(s);
+
+    const int depart = mesh.incident[s];
+    int t = depart;
+    do
+    {
+        const Triangle& T = mesh.triangles[t];
+        int i = T.v[0] == s ? 0 : (T.v[1] == s ? 1 : 2);
+        mesh.pile.push_back(t);
+        modifies.push_back(T.v[(i + 1) % 3]);
+        t = T.voisins[(i + 1) % 3];
+    } while (t != depart);
+}
+
+// Recalcule une seule fois le cercle de chaque triangle empilé dont un sommet a bougé
+template <typename Scalaire>
+static void recalculeCercles(BasicMesh<Scalaire>& mesh)
+{
+    dedoublonne(mesh, mesh.pile);
+    for (int t : mesh.pile)
+        calculeCercle(mesh, t);
+}
+
+template <typename Scalaire>
+bool deplaceSommet(BasicMesh<Scalaire>& mesh, int s, const Point<Scalaire>& P, std::vector<int>& modifies)
+{
+    typedef Predicats<Scalaire> Noyau;
+    modifies.clear();
+    if (s < 0 || s >= (int)mesh.incident.size() || mesh.incident[s] == RETIRE || !Noyau::dansLimites(P.x, P.y))
+        return false;
+
+    if (mesh.incident[s] >= 0)
+    {
+        // Si le sommet reste dans son étoile, on le déplace sur place et quelques bascules
+        // suffisent à réparer la triangulation
+        mesh.pile.clear();
+        if (resteDansEtoile(mesh, s, P))
+        {
+            mesh.sommets[s] = P;
+            empileEtoile(mesh, s, modifies);
+            recalculeCercles(mesh);
+            restaureDelaunay(mesh, modifies);
+            mesh.dernier = mesh.incident[s];
+            remplaceParJumeau(mesh, s, modifies);
+
+            dedoublonne(mesh, modifies);
+            return true;
+        }
+
+        // Sinon on le retire puis on le réinsère à sa nouvelle place, sous le même indice
+        if (!retireSommet(mesh, s, modifies))
+            return false;
+    }
+    else
+    {
+        // Un point confondu avec un sommet quitte la place de ce sommet
+        mesh.detacheJumeau(s);
+    }
+
+    const Point<Scalaire> ancien = mesh.sommets[s];
+    mesh.sommets[s] = P;
+    mesh.incident[s] = -1;
+    bool place = placeSommet(mesh, s, modifies);
+
+    // P n'a pas pu entrer dans le maillage (hors de l'enveloppe, ou sur son bord, sans triangles infinis) :
+    // le point reprend sa place d'avant plutôt que de rester en dehors
+    if (!place && !accueilli(mesh, s))
+    {
+        mesh.sommets[s] = ancien;
+        placeSommet(mesh, s, modifies);
+    }
+
+    dedoublonne(mesh, modifies);
+    return place;
+}
+
+// Retriangule tous les sommets à leur position actuelle, dans l'ordre de Hilbert, sans changer leurs
+// indices : les sommets retirés le restent, les triangles infinis ne sont gardés que si le maillage les
+// avait, et les compteurs continuent ; modifies reçoit tous les sites qui étaient ou sont maintenant
+// dans le maillage (un sommet devenu confondu avec un autre perd sa cellule)
+template <typename Scalaire>
+static void reconstruit(BasicMesh<Scalaire>& mesh, std::vector<int>& modifies)
+{
+    bool infinis = mesh.triangles.size() == mesh.libres.size();
+    for (size_t t=0; t < mesh.triangles.size() && !infinis; t++)
+        infinis = mesh.triangles[t].vivant && !mesh.triangles[t].fini();
+
+    std::vector<char> avaitCellule(mesh.incident.size());
+    for (size_t v=0; v < mesh.incident.size(); v++)
+        avaitCellule[v] = mesh.incident[v] >= 0;
+
+    std::vector<Point<Scalaire>> points = mesh.sommets;
+    std::vector<int> ordre = ordreInsertion(points, OrdreInsertion::Hilbert);
+    std::vector<int> retires;
+    for (int v : ordre)
+    {
+        if (mesh.incident[v] == RETIRE)
+            retires.push_back(v);
+    }
+    ordre.erase(std::remove_if(ordre.begin(), ordre.end(), [&](int v){ return mesh.incident[v] == RETIRE; }), ordre.end());
+
+    const Statistiques stats = mesh.stats;
+    trianguleDelaunay(mesh, points, ordre);
+    mesh.stats.testsCercle += stats.testsCercle;
+    mesh.stats.testsExacts += stats.testsExacts;
+    for (int v : retires)
+        mesh.incident[v] = RETIRE;
+    if (!infinis)
+        retireTrianglesInfinis(mesh);
+
+    for (size_t v=0; v < mesh.incident.size(); v++)
+    {
+        if (mesh.incident[v] != RETIRE && (avaitCellule[v] || mesh.incident[v] >= 0))
+            modifies.push_back(v);
+    }
+}
+
+// Nombre de sommets sortis de leur étoile, et de bascules, en dessous duquel un pas du mode cinétique
+// répare toujours le maillage sur place
+static const size_t REPARATIONS_MIN = 32;
+
+template <typename Scalaire>
+bool deplaceSommets(BasicMesh<Scalaire>& mesh, const std::vector<int>& sites, const std::vector<Point<Scalaire>>& positions, std::vector<int>& modifies)
+{
+    typedef Predicats<Scalaire> Noyau;
+    modifies.clear();
+    bool valide = true;
+
+    // On déplace d'abord sur place tous les sommets qui restent dans leur étoile : la triangulation
+    // reste valide, sans être forcément de Delaunay ; une seule passe de Lawson la répare ensuite
+    // Quand une bonne part des sommets sort de son étoile (points cocycliques, points confondus qui se
+    // séparent) ou que les bascules dépassent deux par sommet, les réparations locales coûteraient plus
+    // qu'une reconstruction complète : on se contente alors de ranger les nouvelles positions et on
+    // retriangule tout. Sur un petit maillage, quelques sommets sortis suffiraient à dépasser ces seuils :
+    // on y garde toujours le chemin local jusqu'à REPARATIONS_MIN sommets sortis ou bascules
+    const size_t n = mesh.sommets.size();
+    bool reconstruire = false;
+    std::vector<int> reportes, liberes;
+    mesh.pile.clear();
+    for (size_t k=0; k < sites.size(); k++)
+    {
+        const int s = sites[k];
+        const Point<Scalaire>& P = positions[k];
+        if (s < 0 || s >= (int)mesh.incident.size() || mesh.incident[s] == RETIRE || !Noyau::dansLimites(P.x, P.y))
+        {
+            valide = false;
+            continue;
+        }
+
+        // Un sommet immobile ne coûte rien, et une fois la reconstruction décidée on ne fait plus que
+        // ranger les positions
+        if (reconstruire || (mesh.sommets[s] == P && mesh.incident[s] >= 0))
+        {
+            mesh.sommets[s] = P;
+            continue;
+        }
+
+        if (mesh.incident[s] >= 0 && resteDansEtoile(mesh, s, P))
+        {
+            mesh.sommets[s] = P;
+            empileEtoile(mesh, s, modifies);
+            if (mesh.jumeaux[s] != -1)
+                liberes.push_back(s);
+        }
+        else
+        {
+            reportes.push_back(k);
+            reconstruire = reportes.size() > REPARATIONS_MIN && 8 * reportes.size() > n;
+        }
+    }
+
+    // Un triangle dont plusieurs sommets ont bougé n'est traité qu'une fois
+    if (!reconstruire)
+    {
+        recalculeCercles(mesh);
+        reconstruire = !restaureDelaunay(mesh, modifies, std::max(2 * n, REPARATIONS_MIN));
+    }
+    if (reconstruire)
+    {
+        for (int k : reportes)
+            mesh.sommets[sites[k]] = positions[k];
+        modifies.clear();
+        reconstruit(mesh, modifies);
+        return valide;
+    }
+
+    // Les points qui étaient confondus avec un sommet déplacé prennent la place qu'il a laissée
+    // Tous les sommets déplacés quittent leur cycle avant qu'on place le premier de ces points : un sommet
+    // arrivé à la place d'un autre ne doit pas y apporter les points restés à sa place d'origine
+    for (int& s : liberes)
+        s = mesh.detacheJumeau(s);
+    for (int s : liberes)
+    {
+        if (s != -1)
+            placeSommet(mesh, s, modifies);
+    }
+
+    // Les sommets qui sortent de leur étoile (ou de l'enveloppe convexe) sont retirés et réinsérés
+    std::vector<int> touches;
+    for (int k : reportes)
+    {
+        valide = deplaceSommet(mesh, sites[k], positions[k], touches) && valide;
+        modifies.insert(modifies.end(), touches.begin(), touches.end());
+    }
+
+    dedoublonne(mesh, modifies);
+    return valide;
+}
+
+template <typename Scalaire>
+bool jumeauxCoherents(const BasicMesh<Scalaire>& mesh)
+{
+    typedef Predicats<Scalaire> Noyau;
+    const int n = mesh.sommets.size();
+    if ((int)mesh.incident.size() != n || (int)mesh.jumeaux.size() != n)
+        return false;
+
+    int depart = 0;
+    while (depart < (int)mesh.triangles.size() && !mesh.triangles[depart].vivant)
+        depart++;
+    if (depart == (int)mesh.triangles.size())
+        return true;
+
+    for (int v=0; v < n; v++)
+    {
+        const int t = mesh.incident[v];
+        if (t == RETIRE)
+        {
+            if (mesh.jumeaux[v] != -1)
+                return false;
+            continue;
+        }
+        if (t >= (int)mesh.triangles.size())
+            return false;
+        if (t >= 0)
+        {
+            const Triangle& T = mesh.triangles[t];
+            if (!T.vivant || (T.v[0] != v && T.v[1] != v && T.v[2] != v))
+                return false;
+        }
+        if (mesh.jumeaux[v] == -1)
+        {
+            // Un point seul hors du maillage n'a pu y entrer parce qu'il est hors de l'enveloppe,
+            // ou sur une de ses arêtes (sans voisin de l'autre côté)
+            if (t == -1)
+            {
+                const Point<Scalaire>& P = mesh.sommets[v];
+                const int u = localiseTriangle(mesh, P, depart);
+                bool dehors = u == -1;
+                for (int i=0; i < 3 && !dehors; i++)
+                {
+                    const Triangle& U = mesh.triangles[u];
+                    const int a = U.v[(i + 1) % 3], b = U.v[(i + 2) % 3];
+                    dehors = U.voisins[i] == -1 && a != INFINI && b != INFINI
+                        && Noyau::orient(mesh.sommet(a).x, mesh.sommet(a).y, mesh.sommet(b).x, mesh.sommet(b).y, P.x, P.y) == 0;
+                }
+                if (!dehors)
+                    return false;
+            }
+            continue;
+        }
+
+        // Le cycle revient à v en au plus n pas, sur des points aux mêmes coordonnées dont un seul est
+        // dans le maillage
+        int suivant = v, dansMaillage = 0, pas = 0;
+        do
+        {
+            if (suivant < 0 || suivant >= n || pas++ == n)
+                return false;
+            if (mesh.incident[suivant] == RETIRE || !(mesh.sommets[suivant] == mesh.sommets[v]))
+                return false;
+            dansMaillage += mesh.incident[suivant] >= 0;
+            suivant = mesh.jumeaux[suivant];
+        } while (suivant != v);
+        if (dansMaillage != 1)
+            return false;
+    }
+    return true;
+}
+
+// Relie les triangles t et u s'ils partagent une arête
+template <typename Scalaire>
+static void relie(BasicMesh<Scalaire>& mesh, int t, int u)
+{
+    Triangle& T = mesh.triangles[t];
+    Triangle& U = mesh.triangles[u];
+    for (int i=0; i < 3; i++)
+    {
+        for (int j=0; j < 3; j++)
+        {
+            if (T.v[(i + 1) % 3] == U.v[(j + 2) % 3] && T.v[(i + 2) % 3] == U.v[(j + 1) % 3])
+            {
+                T.voisins[i] = u;
+                U.voisins[j] = t;
+            }
+        }
+    }
+}
+
+template <typename Scalaire>
+bool pointsDansLimites(const std::vector<Point<Scalaire>>& points)
+{
+    for (const Point<Scalaire>& P : points)
+    {
+        if (!Predicats<Scalaire>::dansLimites(P.x, P.y))
+            return false;
+    }
+    return true;
+}
+
+template <typename Scalaire>
+bool trianguleDelaunay(BasicMesh<Scalaire>& mesh, const std::vector<Point<Scalaire>>& points, const std::vector<int>& ordre)
+{
+    typedef Predicats<Scalaire> Noyau;
+
+    // On vide le maillage
+    mesh.clear();
+
+    // Les prédicats entiers ne sont exacts que sur une plage bornée : on le vérifie une fois ici
+    if (!pointsDansLimites(points))
+        return false;
+
+    mesh.sommets = points;
+    mesh.incident.assign(points.size(), -1);
+    mesh.jumeaux.assign(points.size(), -1);
+
+    // On cherche les trois premiers points non alignés dans l'ordre d'insertion
+    const size_t n = ordre.size();
+    size_t i1 = 1;
+    while (i1 < n && points[ordre[i1]] == points[ordre[0]])
+        i1++;
+    size_t i2 = i1 + 1;
+    while (i2 < n)
+    {
+        const Point<Scalaire>& a = points[ordre[0]];
+        const Point<Scalaire>& b = points[ordre[i1]];
+        const Point<Scalaire>& c = points[ordre[i2]];
+        if (Noyau::orient(a.x, a.y, b.x, b.y, c.x, c.y) != 0)
+            break;
+        i2++;
+    }
+    if (i2 >= n)
+        return true;
+
+    // On créé le premier triangle dans le sens direct, entouré de ses trois triangles infinis
+    int a = ordre[0], b = ordre[i1], c = ordre[i2];
+    if (Noyau::orient(points[a].x, points[a].y, points[b].x, points[b].y, points[c].x, points[c].y) < 0)
+        std::swap(b, c);
+
+    int premier = mesh.ajouteTriangle(a, b, c);
+    int infinis[3] = {
+        mesh.ajouteTriangle(c, b, INFINI),
+        mesh.ajouteTriangle(a, c, INFINI),
+        mesh.ajouteTriangle(b, a, INFINI)
+    };
+    for (int i=0; i < 3; i++)
+    {
+        relie(mesh, premier, infinis[i]);
+        relie(mesh, infinis[i], infinis[(i + 1) % 3]);
+    }
+    mesh.dernier = premier;
+
+    // Pour chaque autre point P du repère, dans l'ordre d'insertion...
+    for (size_t k=1; k < n; k++)
+    {
+        if (k != i1 && k != i2)
+            insereSommet(mesh, ordre[k]);
+    }
+
+    return true;
+}
+
+template <typename Scalaire>
+void retireTrianglesInfinis(BasicMesh<Scalaire>& mesh)
+{
+    // On repère les triangles qui touchent le sommet infini
+    std::vector<int> exterieurs;
+    for (size_t t=0; t < mesh.triangles.size(); t++)
+    {
+        Triangle& T = mesh.triangles[t];
+        if (T.vivant && !T.fini())
+        {
+            T.vivant = false;
+            exterieurs.push_back(t);
+        }
+    }
+    // Les triangles restants qui les bordent sont sur l'enveloppe convexe : ils n'ont plus de voisin de ce côté
+    for (int t : exterieurs)
+    {
+        const Triangle& T = mesh.triangles[t];
+        for (int i=0; i < 3; i++)
+        {
+            int n = T.voisins[i];
+            if (n == -1 || !mesh.triangles[n].vivant)
+                continue;
+
+            Triangle& N = mesh.triangles[n];
+            for (int j=0; j < 3; j++)
+            {
+                if (N.voisins[j] == t)
+                    N.voisins[j] = -1;
+            }
+
+            // Les sommets de l'arête finie gardent un triangle incident vivant
+            for (int v : T.v)
+            {
+                if (v != INFINI && mesh.incident[v] == t)
+                    mesh.incident[v] = n;
+            }
+        }
+    }
+
+    for (int t : exterieurs)
+        mesh.retireTriangle(t);
+    mesh.dernier = -1;
+}
+
+// Millisecondes écoulées depuis debut, et remet debut à maintenant
+static double tempsEcoule(std::chrono::steady_clock::time_point& debut)
+{
+    auto maintenant = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(maintenant - debut).count();
+    debut = maintenant;
+    return ms;
+}
+
+// Une bande de la triangulation parallèle : ses points (indices globaux) et leur triangulation locale
+template <typename Scalaire>
+struct Bande
+{
+    std::vector<int> globaux;
+    BasicMesh<Scalaire> mesh;
+    std::vector<int> numero;
+    int gauche = -1, droite = -1;
+};
+
+// Remplit l'intervalle ]premiere, derniere[ des limites entre bandes en coupant indices[debut, fin)
+// par médianes successives dans l'ordre (x, y) ; les points confondus restent dans la même bande
+template <typename Scalaire>
+static void decoupeBandes(const std::vector<Point<Scalaire>>& points, std::vector<int>& indices, std::vector<size_t>& limites,
+    size_t debut, size_t fin, int premiere, int derniere)
+{
+    if (derniere - premiere < 2)
+        return;
+
+    auto avant = [&](int i, int j){
+        return points[i].x < points[j].x || (points[i].x == points[j].x && points[i].y < points[j].y);
+    };
+
+    const int milieu = (premiere + derniere) / 2;
+    size_t m = std::min(fin, std::max(debut, indices.size() * milieu / (limites.size() - 1)));
+    if (m < fin)
+    {
+        std::nth_element(indices.begin() + debut, indices.begin() + m, indices.begin() + fin, avant);
+        const int pivot = indices[m];
+        m = std::partition(indices.begin() + debut, indices.begin() + m, [&](int i){ return avant(i, pivot); }) - indices.begin();
+    }
+    limites[milieu] = m;
+
+    decoupeBandes(points, indices, limites, debut, m, premiere, milieu);
+    decoupeBandes(points, indices, limites, m, fin, milieu, derniere);
+}
+
+// Couture entre la triangulation déjà cousue à gauche et la bande de droite, séparées dans l'ordre (x, y)
+// suivant et precedent donnent l'enveloppe convexe de chaque côté dans le sens direct, et interieur[p]
+// le triangle qui borde l'arête d'enveloppe (p, suivant[p]) ; on les met à jour pour l'enveloppe réunie
+// On remplit le vide entre les deux enveloppes de bas en haut, en avançant à chaque pas sur l'une
+// d'elles comme dans la fusion de Guibas et Stolfi, sans rien retirer : les bascules finiront le travail
+// Retourne false si la couture tombe sur un cas dégénéré
+template <typename Scalaire>
+static bool coudBandes(BasicMesh<Scalaire>& mesh, int l0, int r0, std::vector<int>& suivant, std::vector<int>& precedent, std::vector<int>& interieur)
+{
+    typedef Predicats<Scalaire> Noyau;
+    auto orient = [&](int a, int b, int c){
+        const Point<Scalaire>& A = mesh.sommet(a);
+        const Point<Scalaire>& B = mesh.sommet(b);
+        const Point<Scalaire>& C = mesh.sommet(c);
+        return Noyau::orient(A.x, A.y, B.x, B.y, C.x, C.y);
+    };
+
+    // Tangentes inférieure (lb, rb) et supérieure (lh, rh) aux deux enveloppes
+    int lb = l0, rb = r0;
+    for (bool bouge = true; bouge; )
+    {
+        bouge = false;
+        while (orient(lb, rb, precedent[lb]) < 0)
+        {
+            lb = precedent[lb];
+            bouge = true;
+        }
+        while (orient(lb, rb, suivant[rb]) < 0)
+        {
+            rb = suivant[rb];
+            bouge = true;
+        }
+    }
+    int lh = l0, rh = r0;
+    for (bool bouge = true; bouge; )
+    {
+        bouge = false;
+        while (orient(lh, rh, suivant[lh]) > 0)
+        {
+            lh = suivant[lh];
+            bouge = true;
+        }
+        while (orient(lh, rh, precedent[rh]) > 0)
+        {
+            rh = precedent[rh];
+            bouge = true;
+        }
+    }
+
+    // L'arête de base (l, r) monte de la tangente inférieure à la tangente supérieure ; bas est le triangle
+    // créé juste en dessous d'elle. Entre les deux tangentes, les deux chaînes montent : le triangle
+    // (l, r, lp) ne peut contenir que rp, et seulement si lp n'est pas plus bas que r (et de même à droite)
+    int l = lb, r = rb, bas = -1, premier = -1;
+    while (l != lh || r != rh)
+    {
+        const int lp = suivant[l], rp = precedent[r];
+        bool gauche = l != lh && orient(l, r, lp) > 0 && (r == rh || mesh.sommet(lp).y < mesh.sommet(r).y || orient(r, lp, rp) <= 0);
+        bool droite = r != rh && orient(l, r, rp) > 0 && (l == lh || mesh.sommet(rp).y < mesh.sommet(l).y || orient(l, rp, lp) >= 0);
+        if (!gauche && !droite)
+            return false;
+
+        // Entre deux candidats possibles, on garde celui dont le triangle a le cercle vide
+        if (gauche && droite)
+        {
+            const Point<Scalaire>& A = mesh.sommet(l);
+            const Point<Scalaire>& B = mesh.sommet(r);
+            const Point<Scalaire>& C = mesh.sommet(lp);
+            const Point<Scalaire>& D = mesh.sommet(rp);
+            gauche = Noyau::dansCercle(A.x, A.y, B.x, B.y, C.x, C.y, D.x, D.y) <= 0;
+        }
+
+        // Le nouveau triangle s'appuie sur l'arête d'enveloppe qu'il recouvre, de l'autre côté de celle-ci
+        const int t = mesh.ajouteTriangle(l, r, gauche ? lp : rp);
+        const int appui = gauche ? interieur[l] : interieur[rp];
+        if (gauche)
+        {
+            mesh.triangles[t].voisins[1] = appui;
+            changeVoisin(mesh, appui, l, lp, t);
+        }
+        else
+        {
+            mesh.triangles[t].voisins[0] = appui;
+            changeVoisin(mesh, appui, r, rp, t);
+        }
+        mesh.triangles[t].voisins[2] = bas;
+        changeVoisin(mesh, bas, l, r, t);
+        mesh.pile.push_back(t);
+
+        if (premier == -1)
+            premier = t;
+        bas = t;
+        if (gauche)
+            l = lp;
+        else
+            r = rp;
+    }
+    if (premier == -1)
+        return false;
+
+    // Les deux tangentes deviennent des arêtes de l'enveloppe réunie
+    suivant[lb] = rb;
+    precedent[rb] = lb;
+    interieur[lb] = premier;
+    suivant[rh] = lh;
+    precedent[lh] = rh;
+    interieur[rh] = bas;
+    return true;
+}
+
+template <typename Scalaire>
+bool trianguleDelaunayParallele(BasicMesh<Scalaire>& mesh, const std::vector<Point<Scalaire>>& points, int nombreThreads, TempsParallele* temps)
+{
+    TempsParallele mesures;
+    auto debut = std::chrono::steady_clock::now();
+
+    // Une bande doit rester assez grande pour que la couture ne coûte presque rien devant elle
+    const size_t n = points.size();
+    const int nombreBandes = nombreTranches(nombreThreads, n, POINTS_PAR_BANDE);
+    if (!pointsDansLimites(points))
+    {
+        mesh.clear();
+        return false;
+    }
+
+    // Avec moins de trois bandes, le découpage, la couture et les bascules coûtent plus que ce que
+    // rapportent les threads : on triangule tout d'un coup
+    if (nombreBandes < 3)
+    {
+        trianguleDelaunay(mesh, points, ordreInsertion(points, OrdreInsertion::Hilbert));
+        mesures.bandes = tempsEcoule(debut);
+        if (temps)
+            *temps = mesures;
+        return true;
+    }
+
+    // Découpage en bandes verticales de même taille
+    std::vector<int> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::vector<size_t> limites(nombreBandes + 1, 0);
+    limites[nombreBandes] = n;
+    decoupeBandes(points, indices, limites, 0, n, 0, nombreBandes);
+    mesures.decoupe = tempsEcoule(debut);
+
+    // Chaque bande est triangulée seule, dans l'ordre de Hilbert, par le moteur séquentiel
+    std::vector<Bande<Scalaire>> bandes(nombreBandes);
+    std::vector<char> valides(nombreBandes, 0);
+    enParallele(nombreBandes, nombreBandes, [&](int k, size_t, size_t){
+        Bande<Scalaire>& bande = bandes[k];
+        // Indices croissants : entre deux points confondus, la bande garde le même que le moteur séquentiel
+        bande.globaux.assign(indices.begin() + limites[k], indices.begin() + limites[k + 1]);
+        std::sort(bande.globaux.begin(), bande.globaux.end());
+        std::vector<Point<Scalaire>> locaux(bande.globaux.size());
+        for (size_t i=0; i < locaux.size(); i++)
+            locaux[i] = points[bande.globaux[i]];
+        trianguleDelaunay(bande.mesh, locaux, ordreInsertion(locaux, OrdreInsertion::Hilbert));
+        valides[k] = bande.mesh.dernier != -1;
+    });
+    mesures.bandes = tempsEcoule(debut);
+
+    // Si une bande n'a que des points alignés, on triangule tout d'un coup
+    bool sequentiel = std::find(valides.begin(), valides.end(), 0) != valides.end();
+    if (!sequentiel)
+    {
+        // Les triangles finis de chaque bande sont recopiés à la suite dans le maillage, avec leurs
+        // sommets et leurs voisins renumérotés ; l'enveloppe de chaque bande est notée à part
+        std::vector<size_t> premierTriangle(nombreBandes + 1, 0);
+        for (int k=0; k < nombreBandes; k++)
+        {
+            size_t compte = 0;
+            for (const Triangle& T : bandes[k].mesh.triangles)
+                compte += T.vivant && T.fini();
+            premierTriangle[k + 1] = premierTriangle[k] + compte;
+        }
+
+        mesh.clear();
+        mesh.sommets = points;
+        mesh.incident.assign(n, -1);
+        mesh.jumeaux.assign(n, -1);
+        mesh.triangles.resize(premierTriangle[nombreBandes]);
+        mesh.cercles.resize(premierTriangle[nombreBandes]);
+        std::vector<int> suivant(n, -1), precedent(n, -1), interieur(n, -1);
+
+        enParallele(nombreBandes, nombreBandes, [&](int k, size_t, size_t){
+            Bande<Scalaire>& bande = bandes[k];
+            const BasicMesh<Scalaire>& local = bande.mesh;
+            // Les points confondus restent dans la même bande, avec leurs jumeaux
+            for (size_t i=0; i < bande.globaux.size(); i++)
+            {
+                if (local.jumeaux[i] != -1)
+                    mesh.jumeaux[bande.globaux[i]] = bande.globaux[local.jumeaux[i]];
+            }
+
+            bande.numero.assign(local.triangles.size(), -1);
+            int suivantLibre = premierTriangle[k];
+            for (size_t t=0; t < local.triangles.size(); t++)
+            {
+                if (local.triangles[t].vivant && local.triangles[t].fini())
+                    bande.numero[t] = suivantLibre++;
+            }
+
+            for (size_t t=0; t < local.triangles.size(); t++)
+            {
+                const Triangle& T = local.triangles[t];
+                if (!T.vivant)
+                    continue;
+
+                // Le triangle infini (INFINI, p, q) borde l'arête d'enveloppe (q, p) du triangle fini voisin
+                if (!T.fini())
+                {
+                    const int i = T.v[0] == INFINI ? 0 : (T.v[1] == INFINI ? 1 : 2);
+                    const int p = bande.globaux[T.v[(i + 1) % 3]], q = bande.globaux[T.v[(i + 2) % 3]];
+                    suivant[q] = p;
+                    precedent[p] = q;
+                    interieur[q] = bande.numero[T.voisins[i]];
+                    continue;
+                }
+
+                const int u = bande.numero[t];
+                Triangle& U = mesh.triangles[u];
+                for (int i=0; i < 3; i++)
+                {
+                    U.v[i] = bande.globaux[T.v[i]];
+                    U.voisins[i] = bande.numero[T.voisins[i]];
+                    mesh.incident[U.v[i]] = u;
+                }
+                mesh.cercles[u] = local.cercles[t];
+            }
+
+            // Les sommets extrêmes de la bande dans l'ordre (x, y), en écartant les points confondus
+            for (int g : bande.globaux)
+            {
+                if (mesh.incident[g] < 0)
+                    continue;
+                if (bande.gauche == -1 || points[g].x < points[bande.gauche].x || (points[g].x == points[bande.gauche].x && points[g].y < points[bande.gauche].y))
+                    bande.gauche = g;
+                if (bande.droite == -1 || points[g].x > points[bande.droite].x || (points[g].x == points[bande.droite].x && points[g].y > points[bande.droite].y))
+                    bande.droite = g;
+            }
+        });
+        std::vector<int> gauches, droites;
+        for (const Bande<Scalaire>& bande : bandes)
+        {
+            mesh.stats.testsCercle += bande.mesh.stats.testsCercle;
+            mesh.stats.testsExacts += bande.mesh.stats.testsExacts;
+            gauches.push_back(bande.gauche);
+            droites.push_back(bande.droite);
+        }
+        bandes.clear();
+
+        // Les bandes sont cousues de gauche à droite : le point le plus à droite de ce qui est déjà
+        // cousu est celui de la dernière bande cousue
+        mesh.pile.clear();
+        for (int k=0; k + 1 < nombreBandes && !sequentiel; k++)
+            sequentiel = !coudBandes(mesh, droites[k], gauches[k + 1], suivant, precedent, interieur);
+        mesures.couture = tempsEcoule(debut);
+
+        if (!sequentiel)
+        {
+            // Les bascules partent des triangles des coutures, seules arêtes qui peuvent ne pas être de Delaunay
+            std::vector<int> modifies;
+            restaureDelaunay(mesh, modifies);
+
+            // On referme l'enveloppe réunie avec ses triangles infinis, en la parcourant depuis le point
+            // le plus à gauche ; les bascules ont pu changer le triangle qui borde chaque arête
+            const int depart = gauches[0];
+            int p = depart, dernierInfini = -1, premierInfini = -1;
+            do
+            {
+                const int q = suivant[p];
+
+                // On tourne autour de p dans le sens indirect jusqu'à l'arête sans voisin, qui est (p, q)
+                int t = mesh.incident[p];
+                int i = 0;
+                while (true)
+                {
+                    const Triangle& T = mesh.triangles[t];
+                    i = T.v[0] == p ? 0 : (T.v[1] == p ? 1 : 2);
+                    if (T.voisins[(i + 2) % 3] == -1)
+                        break;
+                    t = T.voisins[(i + 2) % 3];
+                }
+
+                const int g = mesh.ajouteTriangle(q, p, INFINI);
+                mesh.triangles[t].voisins[(i + 2) % 3] = g;
+                mesh.triangles[g].voisins[2] = t;
+                mesh.incident[p] = mesh.incident[q] = t;
+                if (dernierInfini == -1)
+                    premierInfini = g;
+                else
+                    relie(mesh, dernierInfini, g);
+                dernierInfini = g;
+                p = q;
+            } while (p != depart);
+            relie(mesh, dernierInfini, premierInfini);
+            mesh.dernier = 0;
+            mesures.bascules = tempsEcoule(debut);
+        }
+    }
+
+    if (sequentiel)
+    {
+        trianguleDelaunay(mesh, points, ordreInsertion(points, OrdreInsertion::Hilbert));
+        mesures.bandes += tempsEcoule(debut);
+    }
+    if (temps)
+        *temps = mesures;
+    return true;
+}
+
+// Instanciation des versions du moteur : une par type de coordonnées
+#define INSTANCIE_DELAUNAY(Scalaire) \
+    template struct BasicMesh<Scalaire>; \
+    template int localiseTriangle<Scalaire>(const BasicMesh<Scalaire>&, const Point<Scalaire>&, int); \
+    template bool insereSommet<Scalaire>(BasicMesh<Scalaire>&, int); \
+    template bool ajoutePoint<Scalaire>(BasicMesh<Scalaire>&, const Point<Scalaire>&, std::vector<int>&); \
+    template bool retireSommet<Scalaire>(BasicMesh<Scalaire>&, int, std::vector<int>&); \
+    template bool deplaceSommet<Scalaire>(BasicMesh<Scalaire>&, int, const Point<Scalaire>&, std::vector<int>&); \
+    template bool deplaceSommets<Scalaire>(BasicMesh<Scalaire>&, const std::vector<int>&, const std::vector<Point<Scalaire>>&, std::vector<int>&); \
+    template bool jumeauxCoherents<Scalaire>(const BasicMesh<Scalaire>&); \
+    template bool pointsDansLimites<Scalaire>(const std::vector<Point<Scalaire>>&); \
+    template bool trianguleDelaunay<Scalaire>(BasicMesh<Scalaire>&, const std::vector<Point<Scalaire>>&, const std::vector<int>&); \
+    template void retireTrianglesInfinis<Scalaire>(BasicMesh<Scalaire>&); \
+    template bool trianguleDelaunayParallele<Scalaire>(BasicMesh<Scalaire>&, const std::vector<Point<Scalaire>>&, int, TempsParallele*);
+
+INSTANCIE_DELAUNAY(int)
+INSTANCIE_DELAUNAY(float)
+INSTANCIE_DELAUNAY(double)
+#ifdef __SIZEOF_INT128__
+INSTANCIE_DELAUNAY(std::int64_t)
+#endif
@@ -0,0 +1,222 @@
+#ifndef DELAUNAY_H
+#define DELAUNAY_H
+#include "geometry.h"
+#include <cstddef>
+#include <vector>
+
+// Sommet symbolique placé à l'infini, à la place d'un super triangle
+const int INFINI = -1;
+
+// Valeur de BasicMesh::incident pour un sommet retiré du maillage : il garde son indice
+// mais n'est plus jamais réinséré
+const int RETIRE = -2;
+
+// Triangle du maillage : on ne stocke que des indices.
+// v[i] est un indice dans Mesh::sommets (ou INFINI) et voisins[i] est le triangle
+// qui partage l'arête opposée au sommet v[i], ou -1 s'il n'y en a pas.
+// Chaque arête de l'enveloppe convexe est bordée à l'extérieur par un triangle infini
+// formé de cette arête et du sommet INFINI.
+struct Triangle
+{
+    int v[3];
+    int voisins[3];
+    bool vivant = true;
+
+    bool fini() const
+    {
+        return v[0] != INFINI && v[1] != INFINI && v[2] != INFINI;
+    }
+};
+
+// Cercle circonscrit d'un triangle
+// marge est l'écart au carré du rayon en dessous duquel on ne fait pas confiance au cercle
+// calculé en double et où l'on repasse par le prédicat exact
+struct Cercle
+{
+    double x, y;
+    double rayon2, marge;
+};
+
+// Arête du bord de la cavité : (a, b) dans le sens du triangle supprimé,
+// exterieur est le triangle resté de l'autre côté et cote l'indice de l'arête dans ce triangle
+struct AreteBord
+{
+    int a, b;
+    int exterieur, cote;
+    int nouveau;
+};
+
+// Case de la table de hachage qui relie les nouveaux triangles autour du point inséré
+struct CaseArete
+{
+    int sommet, triangle;
+};
+
+// Compteurs de travail de la triangulation, remis à zéro avec le maillage (pour les mesures)
+struct Statistiques
+{
+    long long testsCercle = 0;  // tests du cercle circonscrit
+    long long testsExacts = 0;  // tests que le cercle en cache n'a pas suffi à trancher
+};
+
+// Maillage triangulaire indexé avec adjacence, paramétré par le type des coordonnées
+// Les cases des triangles supprimés sont gardées dans une liste libre et réutilisées
+template <typename T>
+struct BasicMesh
+{
+    std::vector<Point<T>> sommets;
+    std::vector<Triangle> triangles;
+    std::vector<int> libres;
+
+    // Cercle circonscrit de chaque triangle, calculé une seule fois à sa création
+    // (rangés à part des triangles, même indice)
+    std::vector<Cercle> cercles;
+
+    // Un triangle vivant qui touche chaque sommet (-1 si le sommet n'est pas dans le maillage,
+    // RETIRE s'il en a été retiré), pour tourner autour d'un sommet sans parcourir tout le maillage
+    std::vector<int> incident;
+
+    // Un point confondu avec un sommet du maillage n'y est pas inséré : il forme avec ce sommet un cycle
+    // (jumeaux[v] est le suivant, -1 pour un point seul à sa place), pour prendre sa place quand le
+    // sommet est retiré ou déplacé
+    std::vector<int> jumeaux;
+
+    // Dernier triangle créé, point de départ de la prochaine localisation
+    int dernier = -1;
+
+    // Tampons réutilisés d'une insertion à l'autre, pour ne rien allouer par point
+    std::vector<int> cavite;
+    std::vector<AreteBord> bord;
+    std::vector<CaseArete> table;
+    std::vector<int> pile;
+    std::vector<char> vus;
+
+    Statistiques stats;
+
+    // Coordonnées d'un sommet fini
+    const Point<T>& sommet(int v) const
+    {
+        return sommets[v];
+    }
+
+    int ajouteTriangle(int a, int b, int c);
+    void retireTriangle(int t);
+    void clear();
+
+    // Ajoute s, avec les points qui lui sont déjà confondus, au cycle des points confondus avec v
+    void ajouteJumeau(int v, int s);
+
+    // Sort s du cycle de ses points confondus ; retourne le plus petit indice de ceux qui restent
+    // (-1 s'il n'y en a pas)
+    int detacheJumeau(int s);
+};
+
+// Maillage sur les coordonnées entières de l'écran
+typedef BasicMesh<int> Mesh;
+
+// Les fonctions suivantes sont instanciées dans delaunay.cpp pour int, std::int64_t (si le
+// compilateur a des entiers 128 bits), float et double ; chaque version utilise le noyau
+// Predicats<T> correspondant, choisi à la compilation
+
+// Cherche le triangle qui contient P en marchant dans le maillage depuis le triangle depart
+// Si P est en dehors de l'enveloppe convexe, retourne le triangle infini de l'arête traversée
+// (ou -1 si les triangles infinis ont été retirés)
+template <typename T>
+int localiseTriangle(const BasicMesh<T>& mesh, const Point<T>& P, int depart);
+
+// Insère le site d'indice s (déjà présent dans mesh.sommets) dans la triangulation
+// Retourne false si le point ne peut pas être placé dans le maillage (hors de l'enveloppe ou sur son
+// bord alors que les triangles infinis ont été retirés) ou s'il est confondu avec un sommet existant
+template <typename T>
+bool insereSommet(BasicMesh<T>& mesh, int s);
+
+// Ajoute le point P à la fin de mesh.sommets et l'insère dans la triangulation existante,
+// sans la reconstruire : seuls les triangles dont le cercle contient P sont remplacés
+// modifies reçoit les sites dont les triangles ont changé (et donc la cellule de Voronoi)
+// Le point est ajouté aux sommets même s'il n'est pas inséré, pour que les indices restent
+// ceux de l'appelant ; retourne false s'il est confondu avec un sommet, hors de la plage
+// supportée, ou hors de l'enveloppe (ou sur son bord) alors que les triangles infinis ont été retirés
+template <typename T>
+bool ajoutePoint(BasicMesh<T>& mesh, const Point<T>& P, std::vector<int>& modifies);
+
+// Retire le sommet s de la triangulation en ne retriangulant que le trou laissé par ses triangles,
+// puis en basculant les arêtes qui ne sont plus de Delaunay ; s garde son indice dans mesh.sommets
+// Un point qui était confondu avec s est inséré à sa place (de même quand s est déplacé), et un
+// point confondu qui n'est pas dans le maillage est simplement retiré
+// modifies reçoit les sites dont les triangles ont changé (dont s, qui n'a plus de cellule)
+// Retourne false si s n'est pas dans le maillage, ou s'il est sur l'enveloppe convexe alors que
+// les triangles infinis ont été retirés
+template <typename T>
+bool retireSommet(BasicMesh<T>& mesh, int s, std::vector<int>& modifies);
+
+// Déplace le sommet s en P : si P reste dans l'étoile de s, on le déplace sur place et on bascule
+// les arêtes autour ; sinon on le retire et on le réinsère sous le même indice
+// modifies reçoit les sites dont les triangles ont changé
+// Retourne false si s a été retiré ou si P ne peut pas être inséré (voir ajoutePoint) ; si P est hors
+// de l'enveloppe (ou sur son bord) d'un maillage sans triangles infinis, s reprend sa place d'avant
+template <typename T>
+bool deplaceSommet(BasicMesh<T>& mesh, int s, const Point<T>& P, std::vector<int>& modifies);
+
+// Un pas du mode cinétique : déplace chaque sommet sites[k] en positions[k]
+// Les sommets qui restent dans leur étoile sont déplacés sur place, puis une seule passe de
+// bascules (Lawson) répare la triangulation là où la propriété du cercle vide n'est plus vérifiée :
+// pour un petit mouvement, le coût suit le nombre de bascules et non le nombre de points
+// Les autres sommets sont retirés et réinsérés comme avec deplaceSommet
+// Si plus d'un huitième des sommets sort de son étoile, ou s'il faut plus de deux bascules par sommet
+// (au-delà de quelques-uns, pour qu'un petit maillage reste réparé sur place), on retriangule plutôt tous les sommets aux nouvelles positions (modifies reçoit alors tous les sites
+// qui étaient ou sont dans le maillage, y compris ceux qui, devenus confondus, n'ont plus de cellule)
+// modifies reçoit les sites dont les triangles ont changé ; retourne false si un sommet n'a pas pu
+// être placé
+template <typename T>
+bool deplaceSommets(BasicMesh<T>& mesh, const std::vector<int>& sites, const std::vector<Point<T>>& positions, std::vector<int>& modifies);
+
+// Vérifie les points confondus du maillage, pour les essais : chaque point qui n'a pas été retiré est
+// un sommet du maillage, ou fait partie d'un cycle de points aux mêmes coordonnées autour d'un seul
+// sommet du maillage, ou est hors de l'enveloppe d'un maillage sans triangles infinis (ou sur son bord)
+// Un maillage vide (points alignés) attend la prochaine construction complète et est toujours valide
+template <typename T>
+bool jumeauxCoherents(const BasicMesh<T>& mesh);
+
+// Vérifie que tous les points sont dans la plage de coordonnées supportée par les prédicats
+// (coordonnées finies pour les flottants), avant de calculer quoi que ce soit sur eux
+template <typename T>
+bool pointsDansLimites(const std::vector<Point<T>>& points);
+
+// Triangule l'ensemble des points par l'algorithme de Bowyer-Watson
+// Les points sont insérés dans l'ordre donné par la permutation ordre
+// Le maillage garde ses triangles infinis, on peut donc y insérer des points n'importe où
+// S'il n'y a pas trois points non alignés, le maillage reste vide
+// Retourne false si un point sort de la plage de coordonnées supportée par les prédicats
+template <typename T>
+bool trianguleDelaunay(BasicMesh<T>& mesh, const std::vector<Point<T>>& points, const std::vector<int>& ordre);
+
+// Durées des étapes de trianguleDelaunayParallele, en millisecondes
+struct TempsParallele
+{
+    double decoupe = 0;   // découpage des points en bandes
+    double bandes = 0;    // triangulation des bandes, chacune sur son thread
+    double couture = 0;   // recopie des bandes dans le maillage et couture des bandes voisines
+    double bascules = 0;  // bascules le long des coutures et triangles infinis de l'enveloppe
+};
+
+// Nombre minimum de points d'une bande de trianguleDelaunayParallele
+const size_t POINTS_PAR_BANDE = 16384;
+
+// Triangule l'ensemble des points sur nombreThreads threads (0 pour tous les coeurs) : les points sont
+// coupés en bandes verticales triangulées en même temps, puis cousues deux à deux et rendues de
+// Delaunay par bascules. Le résultat est la même triangulation que trianguleDelaunay quand il n'y a
+// pas quatre points cocycliques (seule la numérotation des triangles change)
+// Il y a une bande par thread, tant que chacune garde au moins POINTS_PAR_BANDE points ; avec moins de
+// trois bandes (moins de trois threads ou moins de 3 × POINTS_PAR_BANDE points), ou si une bande n'a que
+// des points alignés, on se rabat sur trianguleDelaunay dans l'ordre de Hilbert
+// temps reçoit la durée de chaque étape s'il n'est pas nul ; retourne false comme trianguleDelaunay
+template <typename T>
+bool trianguleDelaunayParallele(BasicMesh<T>& mesh, const std::vector<Point<T>>& points, int nombreThreads, TempsParallele* temps = nullptr);
+
+// Supprime les triangles infinis : il ne reste que la triangulation de l'enveloppe
+// convexe des points, dont les arêtes extérieures n'ont plus de voisin (-1)
+// On ne peut plus insérer de point en dehors de l'enveloppe ensuite
+template <typename T>
+void retireTrianglesInfinis(BasicMesh<T>& mesh);
+
+#endif
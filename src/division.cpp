@@ -0,0 +1,404 @@
+#include "division.h"
+#include "parallele.h"
+#include "predicates.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+// Structure quad-edge de Guibas et Stolfi : chaque arête a quatre quarts numérotés 4 q + r,
+// r = 0 et 2 pour les deux sens de l'arête, r = 1 et 3 pour son arête duale
+// suivant[e] est le quart suivant autour de l'origine de e dans le sens direct (onext) et origine[e]
+// le sommet d'où part e (-1 pour les quarts duaux et les arêtes supprimées)
+struct QuadEdges
+{
+    std::vector<int> suivant;
+    std::vector<int> origine;
+    std::vector<int> libres;
+    long long testsCercle = 0;
+};
+
+static int rot(int e)
+{
+    return (e & ~3) | ((e + 1) & 3);
+}
+
+static int rotInverse(int e)
+{
+    return (e & ~3) | ((e + 3) & 3);
+}
+
+static int sym(int e)
+{
+    return e ^ 2;
+}
+
+// Arête précédente autour de l'origine, suivante autour de la face gauche et précédente autour de la face droite
+static int oprev(const QuadEdges& q, int e)
+{
+    return rot(q.suivant[rot(e)]);
+}
+
+static int lnext(const QuadEdges& q, int e)
+{
+    return rot(q.suivant[rotInverse(e)]);
+}
+
+static int rprev(const QuadEdges& q, int e)
+{
+    return q.suivant[sym(e)];
+}
+
+static int destination(const QuadEdges& q, int e)
+{
+    return q.origine[sym(e)];
+}
+
+// Nouvelle arête isolée de a vers b
+static int creeArete(QuadEdges& q, int a, int b)
+{
+    int e;
+    if (!q.libres.empty())
+    {
+        e = q.libres.back();
+        q.libres.pop_back();
+    }
+    else
+    {
+        e = q.suivant.size();
+        q.suivant.resize(e + 4);
+        q.origine.resize(e + 4);
+    }
+    q.suivant[e] = e;
+    q.suivant[e + 1] = e + 3;
+    q.suivant[e + 2] = e + 2;
+    q.suivant[e + 3] = e + 1;
+    q.origine[e] = a;
+    q.origine[e + 1] = -1;
+    q.origine[e + 2] = b;
+    q.origine[e + 3] = -1;
+    return e;
+}
+
+// Opération splice : réunit ou sépare les anneaux d'arêtes autour des origines de a et de b
+static void splice(QuadEdges& q, int a, int b)
+{
+    const int alpha = rot(q.suivant[a]);
+    const int beta = rot(q.suivant[b]);
+    std::swap(q.suivant[a], q.suivant[b]);
+    std::swap(q.suivant[alpha], q.suivant[beta]);
+}
+
+// Relie la destination de a à l'origine de b par une nouvelle arête, qui garde a et b sur sa gauche
+static int relieAretes(QuadEdges& q, int a, int b)
+{
+    const int e = creeArete(q, destination(q, a), q.origine[b]);
+    splice(q, e, lnext(q, a));
+    splice(q, sym(e), b);
+    return e;
+}
+
+static void supprimeArete(QuadEdges& q, int e)
+{
+    splice(q, e, oprev(q, e));
+    splice(q, sym(e), oprev(q, sym(e)));
+    e &= ~3;
+    q.origine[e] = q.origine[e + 2] = -1;
+    q.libres.push_back(e);
+}
+
+// Triangulation récursive des points tries[debut, fin), déjà triés dans l'ordre (x, y) et distincts
+template <typename Scalaire>
+struct Division
+{
+    typedef Predicats<Scalaire> Noyau;
+
+    const std::vector<Point<Scalaire>>& points;
+    const std::vector<int>& tries;
+
+    // Sous-arbres déjà triangulés à la profondeur niveau, rangés de gauche à droite (vide si aucun)
+    int niveau = 0;
+    std::vector<std::pair<int, int>> sousArbres;
+
+    Division(const std::vector<Point<Scalaire>>& points, const std::vector<int>& tries) : points(points), tries(tries)
+    {
+    }
+
+    bool direct(int a, int b, int c) const
+    {
+        const Point<Scalaire>& A = points[a];
+        const Point<Scalaire>& B = points[b];
+        const Point<Scalaire>& C = points[c];
+        return Noyau::orient(A.x, A.y, B.x, B.y, C.x, C.y) > 0;
+    }
+
+    // d est strictement dans le cercle du triangle direct (a, b, c)
+    bool dansCercle(QuadEdges& q, int a, int b, int c, int d) const
+    {
+        q.testsCercle++;
+        const Point<Scalaire>& A = points[a];
+        const Point<Scalaire>& B = points[b];
+        const Point<Scalaire>& C = points[c];
+        const Point<Scalaire>& D = points[d];
+        return Noyau::dansCercle(A.x, A.y, B.x, B.y, C.x, C.y, D.x, D.y) > 0;
+    }
+
+    // Retourne (ldo, rdo) : l'arête d'enveloppe qui part du point le plus à gauche dans le sens
+    // indirect, et celle qui part du point le plus à droite dans le sens direct
+    std::pair<int, int> triangule(QuadEdges& q, size_t debut, size_t fin, int profondeur, size_t rang)
+    {
+        if (profondeur == niveau && !sousArbres.empty())
+            return sousArbres[rang];
+
+        const size_t n = fin - debut;
+        if (n == 2)
+        {
+            const int a = creeArete(q, tries[debut], tries[debut + 1]);
+            return {a, sym(a)};
+        }
+        if (n == 3)
+        {
+            const int s0 = tries[debut], s1 = tries[debut + 1], s2 = tries[debut + 2];
+            const int a = creeArete(q, s0, s1);
+            const int b = creeArete(q, s1, s2);
+            splice(q, sym(a), b);
+            if (direct(s0, s1, s2))
+            {
+                relieAretes(q, b, a);
+                return {a, sym(b)};
+            }
+            if (direct(s0, s2, s1))
+            {
+                const int c = relieAretes(q, b, a);
+                return {sym(c), c};
+            }
+            return {a, sym(b)};
+        }
+
+        const size_t milieu = (debut + fin) / 2;
+        std::pair<int, int> gauche = triangule(q, debut, milieu, profondeur + 1, 2 * rang);
+        std::pair<int, int> droite = triangule(q, milieu, fin, profondeur + 1, 2 * rang + 1);
+        return fusionne(q, gauche.first, gauche.second, droite.first, droite.second);
+    }
+
+    // Fusion de Guibas et Stolfi : on monte de la tangente inférieure à la tangente supérieure en
+    // supprimant les arêtes de chaque moitié dont le cercle contient un point de l'autre
+    std::pair<int, int> fusionne(QuadEdges& q, int ldo, int ldi, int rdi, int rdo)
+    {
+        // Tangente inférieure
+        while (true)
+        {
+            if (direct(q.origine[rdi], q.origine[ldi], destination(q, ldi)))
+                ldi = lnext(q, ldi);
+            else if (direct(q.origine[ldi], destination(q, rdi), q.origine[rdi]))
+                rdi = rprev(q, rdi);
+            else
+                break;
+        }
+
+        int base = relieAretes(q, sym(rdi), ldi);
+        if (q.origine[ldi] == q.origine[ldo])
+            ldo = sym(base);
+        if (q.origine[rdi] == q.origine[rdo])
+            rdo = base;
+
+        // Un candidat est valide s'il est au-dessus de la base
+        auto valide = [&](int e){
+            return direct(destination(q, e), destination(q, base), q.origine[base]);
+        };
+
+        while (true)
+        {
+            int lcand = q.suivant[sym(base)];
+            if (valide(lcand))
+            {
+                while (dansCercle(q, destination(q, base), q.origine[base], destination(q, lcand), destination(q, q.suivant[lcand])))
+                {
+                    const int suivante = q.suivant[lcand];
+                    supprimeArete(q, lcand);
+                    lcand = suivante;
+                }
+            }
+
+            int rcand = oprev(q, base);
+            if (valide(rcand))
+            {
+                while (dansCercle(q, destination(q, base), q.origine[base], destination(q, rcand), destination(q, oprev(q, rcand))))
+                {
+                    const int suivante = oprev(q, rcand);
+                    supprimeArete(q, rcand);
+                    rcand = suivante;
+                }
+            }
+
+            const bool gauche = valide(lcand), droite = valide(rcand);
+            if (!gauche && !droite)
+                break;
+            if (!gauche || (droite && dansCercle(q, destination(q, lcand), q.origine[lcand], q.origine[rcand], destination(q, rcand))))
+                base = relieAretes(q, rcand, sym(base));
+            else
+                base = relieAretes(q, sym(base), sym(lcand));
+        }
+        return {ldo, rdo};
+    }
+};
+
+// Découpe tries[debut, fin) comme la récursion jusqu'à la profondeur niveau et note les intervalles
+static void intervalles(size_t debut, size_t fin, int niveau, std::vector<std::pair<size_t, size_t>>& sortie)
+{
+    if (niveau == 0)
+    {
+        sortie.push_back({debut, fin});
+        return;
+    }
+    const size_t milieu = (debut + fin) / 2;
+    intervalles(debut, milieu, niveau - 1, sortie);
+    intervalles(milieu, fin, niveau - 1, sortie);
+}
+
+template <typename Scalaire>
+bool trianguleDivision(BasicMesh<Scalaire>& mesh, const std::vector<Point<Scalaire>>& points, int nombreThreads)
+{
+    typedef Predicats<Scalaire> Noyau;
+
+    mesh.clear();
+    for (const Point<Scalaire>& P : points)
+    {
+        if (!Noyau::dansLimites(P.x, P.y))
+            return false;
+    }
+    const size_t n = points.size();
+    mesh.sommets = points;
+    mesh.incident.assign(n, -1);
+    mesh.jumeaux.assign(n, -1);
+
+    // Tri dans l'ordre (x, y) ; entre des points confondus, on garde celui de plus petit indice
+    // et les autres sont notés comme ses jumeaux
+    std::vector<int> tries(n);
+    std::iota(tries.begin(), tries.end(), 0);
+    std::sort(tries.begin(), tries.end(), [&](int a, int b){
+        if (points[a].x != points[b].x)
+            return points[a].x < points[b].x;
+        if (points[a].y != points[b].y)
+            return points[a].y < points[b].y;
+        return a < b;
+    });
+    for (size_t i=1, garde=0; i < n; i++)
+    {
+        if (points[tries[i]] == points[tries[garde]])
+            mesh.ajouteJumeau(tries[garde], tries[i]);
+        else
+            garde = i;
+    }
+    tries.erase(std::unique(tries.begin(), tries.end(), [&](int a, int b){ return points[a] == points[b]; }), tries.end());
+    if (tries.size() < 3)
+        return true;
+
+    // Les sous-arbres du haut de la récursion sont triangulés chacun sur son thread, dans sa propre
+    // structure, puis recopiés à la suite ; les fusions au-dessus restent sur le thread appelant
+    Division<Scalaire> division(points, tries);
+    QuadEdges q;
+    q.suivant.reserve(4 * 3 * tries.size());
+    q.origine.reserve(4 * 3 * tries.size());
+    const int tranches = nombreTranches(nombreThreads, tries.size(), 16384);
+    while ((1 << (division.niveau + 1)) <= tranches)
+        division.niveau++;
+    if (division.niveau > 0)
+    {
+        std::vector<std::pair<size_t, size_t>> bornes;
+        intervalles(0, tries.size(), division.niveau, bornes);
+        std::vector<QuadEdges> locales(bornes.size());
+        std::vector<std::pair<int, int>> resultats(bornes.size());
+        enParallele((int)bornes.size(), bornes.size(), [&](int k, size_t, size_t){
+            resultats[k] = division.triangule(locales[k], bornes[k].first, bornes[k].second, division.niveau, 0);
+        });
+
+        for (size_t k=0; k < locales.size(); k++)
+        {
+            const int decalage = q.suivant.size();
+            for (int e : locales[k].suivant)
+                q.suivant.push_back(e + decalage);
+            q.origine.insert(q.origine.end(), locales[k].origine.begin(), locales[k].origine.end());
+            for (int e : locales[k].libres)
+                q.libres.push_back(e + decalage);
+            q.testsCercle += locales[k].testsCercle;
+            division.sousArbres.push_back({resultats[k].first + decalage, resultats[k].second + decalage});
+        }
+    }
+    division.triangule(q, 0, tries.size(), 0, 0);
+
+    // Chaque face intérieure devient un triangle fini ; la face extérieure donne un triangle infini
+    // par arête d'enveloppe. face[e] est le triangle à gauche du quart e
+    std::vector<int> face(q.suivant.size(), -1);
+    mesh.triangles.reserve(2 * tries.size());
+    mesh.cercles.reserve(2 * tries.size());
+    for (size_t e=0; e < q.suivant.size(); e += 2)
+    {
+        if (q.origine[e] == -1 || face[e] != -1)
+            continue;
+        const int e1 = lnext(q, e), e2 = lnext(q, e1);
+        if (lnext(q, e2) == (int)e && division.direct(q.origine[e], q.origine[e1], q.origine[e2]))
+        {
+            const int t = mesh.ajouteTriangle(q.origine[e], q.origine[e1], q.origine[e2]);
+            face[e] = face[e1] = face[e2] = t;
+            if (mesh.dernier == -1)
+                mesh.dernier = t;
+            continue;
+        }
+        int f = e;
+        do
+        {
+            face[f] = mesh.ajouteTriangle(q.origine[f], destination(q, f), INFINI);
+            f = lnext(q, f);
+        } while (f != (int)e);
+    }
+
+    // Tous les points alignés : pas de triangle, comme avec trianguleDelaunay
+    if (mesh.dernier == -1)
+    {
+        mesh.triangles.clear();
+        mesh.cercles.clear();
+        mesh.incident.assign(n, -1);
+        return true;
+    }
+
+    // Le quart e va de v[i] à v[i + 1] dans son triangle : le voisin opposé à v[i + 2] est à gauche de sym(e)
+    // Dans un triangle infini (p, q, INFINI), les voisins à travers (q, INFINI) et (INFINI, p) sont les
+    // triangles infinis des arêtes d'enveloppe suivante et précédente
+    for (size_t e=0; e < q.suivant.size(); e += 2)
+    {
+        if (q.origine[e] == -1)
+            continue;
+        Triangle& T = mesh.triangles[face[e]];
+        const int i = T.v[0] == q.origine[e] ? 0 : (T.v[1] == q.origine[e] ? 1 : 2);
+        T.voisins[(i + 2) % 3] = face[sym(e)];
+        if (!T.fini())
+        {
+            const int g = face[lnext(q, e)];
+            T.voisins[0] = g;
+            mesh.triangles[g].voisins[1] = face[e];
+        }
+    }
+
+    // Le triangle incident de chaque sommet est un triangle fini
+    for (size_t t=0; t < mesh.triangles.size(); t++)
+    {
+        const Triangle& T = mesh.triangles[t];
+        if (T.fini())
+        {
+            for (int v : T.v)
+                mesh.incident[v] = t;
+        }
+    }
+
+    // Sans cercle en cache, chaque test du cercle passe par le prédicat exact
+    mesh.stats.testsCercle = mesh.stats.testsExacts = q.testsCercle;
+    return true;
+}
+
+template bool trianguleDivision<int>(BasicMesh<int>&, const std::vector<Point<int>>&, int);
+template bool trianguleDivision<float>(BasicMesh<float>&, const std::vector<Point<float>>&, int);
+template bool trianguleDivision<double>(BasicMesh<double>&, const std::vector<Point<double>>&, int);
+#ifdef __SIZEOF_INT128__
+template bool trianguleDivision<std::int64_t>(BasicMesh<std::int64_t>&, const std::vector<Point<std::int64_t>>&, int);
+#endif
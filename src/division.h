@@ -0,0 +1,27 @@
+#ifndef DIVISION_H
+#define DIVISION_H
+#include "geometry.h"
+#include "delaunay.h"
+#include <vector>
+
+// Moteur qui construit la triangulation complète d'un ensemble de points
+enum class MoteurDelaunay
+{
+    Insertion,  // Bowyer-Watson, point par point dans l'ordre d'insertion choisi (ou par bandes sur plusieurs threads)
+    Division    // diviser pour régner de Guibas et Stolfi sur les points triés selon x
+};
+
+// Triangule l'ensemble des points par l'algorithme diviser pour régner de Guibas et Stolfi :
+// les points triés dans l'ordre (x, y) sont coupés en deux moitiés triangulées séparément, puis
+// fusionnées de bas en haut ; le travail se fait sur une structure quad-edge, recopiée à la fin
+// dans le maillage, qui garde ses triangles infinis comme avec trianguleDelaunay
+// Coûte O(n log n) dans le pire cas, quel que soit l'ordre des points ; sur plusieurs threads
+// (0 pour tous les coeurs), les sous-arbres du haut de la récursion sont triangulés en même temps,
+// sans changer le résultat
+// Même triangulation que trianguleDelaunay quand il n'y a pas quatre points cocycliques ; entre des
+// points confondus, on garde celui de plus petit indice. Retourne false comme trianguleDelaunay
+// (instanciée pour les mêmes types de coordonnées)
+template <typename T>
+bool trianguleDivision(BasicMesh<T>& mesh, const std::vector<Point<T>>& points, int nombreThreads = 1);
+
+#endif
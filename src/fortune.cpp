@@ -0,0 +1,455 @@
+#include "fortune.h"
+#include "predicates.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <queue>
+#include <type_traits>
+#include <utility>
+
+// Morceau d'arête du diagramme dessiné par les points de rupture : le site gauche est à gauche quand
+// on va de debut vers fin ; une extrémité reste à -1 si elle part à l'infini
+struct Trace
+{
+    int gauche, droite;
+    int debut, fin;
+};
+
+// Hauteur maximale de la liste à niveaux qui range la ligne de plage : avec un niveau de plus pour
+// un noeud sur quatre, elle suffit jusqu'à des millions de points de rupture
+const int NIVEAUX = 12;
+
+// Point de rupture entre l'arc du site gauche et celui du site droite, de gauche à droite sur la ligne de plage
+// Il dessine une trace (il en fixe la fin, ou le début pour la moitié qui part vers la gauche d'une arête née
+// d'un site) et porte l'événement de cercle de l'arc à sa droite (-1 s'il n'y en a pas)
+// Son abscisse est gardée pour la position du balayage où elle a été calculée : un noeud comparé plusieurs
+// fois pendant une recherche, ou par plusieurs sites à la même hauteur, n'est calculé qu'une fois
+// Les noeuds sont chaînés dans les deux sens à chacun de leurs niveaux (-1 au bout de la liste)
+struct PointRupture
+{
+    int gauche, droite;
+    int trace;
+    bool versDebut;
+    int evenement;
+
+    double x, balayage;
+
+    int niveaux;
+    int suivants[NIVEAUX];
+    int precedents[NIVEAUX];
+};
+
+// Événement de cercle : le haut du cercle des trois sites, quand l'arc du milieu disparaît
+struct EvenementCercle
+{
+    double y, x;
+    int numero;
+
+    bool operator<(const EvenementCercle& autre) const
+    {
+        // La file de priorité sort le plus grand : on inverse pour sortir le plus bas
+        return y > autre.y || (y == autre.y && x > autre.x);
+    }
+};
+
+// Arc qui disparaît à un événement de cercle : le point de rupture à sa gauche et le centre du cercle
+struct Disparition
+{
+    int rupture;
+    SommetVoronoi centre;
+};
+
+// Abscisse du point de rupture entre les arcs de a (à gauche) et de b quand la droite de balayage est en L
+// Un site sur la droite n'a encore qu'un arc vertical ; on choisit pour chaque signe de b.x - a.x
+// la forme de la racine qui n'ajoute pas deux nombres de signes opposés
+static double abscisse(const SommetVoronoi& a, const SommetVoronoi& b, double L)
+{
+    const double da = 2 * (L - a.y), db = 2 * (L - b.y);
+    if (da == 0 && db == 0)
+        return (a.x + b.x) / 2;
+    if (da == 0)
+        return a.x;
+    if (db == 0)
+        return b.x;
+
+    const double dx = b.x - a.x, dy = a.y - b.y;
+    const double s = std::sqrt(da * db * (dx * dx + dy * dy));
+    if (dx >= 0)
+        return a.x + da * (2 * dx * dx + db * dy) / (2 * (da * dx + s));
+    return a.x + (da * dx - s) / (2 * (b.y - a.y));
+}
+
+// Centre du cercle passant par a, b et c, calculé depuis a pour garder des nombres petits
+static SommetVoronoi centre(const SommetVoronoi& a, const SommetVoronoi& b, const SommetVoronoi& c)
+{
+    const double bx = b.x - a.x, by = b.y - a.y;
+    const double cx = c.x - a.x, cy = c.y - a.y;
+    const double lb = bx * bx + by * by, lc = cx * cx + cy * cy;
+    const double d = 2 * (bx * cy - by * cx);
+    return {a.x + (cy * lb - by * lc) / d, a.y + (bx * lc - cx * lb) / d};
+}
+
+// Écart entre deux coordonnées, soustraites dans leur type quand il est entier : loin de l'origine,
+// une coordonnée 64 bits convertie en double perd ses derniers bits, pas leur différence
+template <typename T>
+static double ecart(T a, T b)
+{
+    if constexpr (std::is_integral<T>::value)
+        return (double)(a - b);
+    else
+        return (double)a - (double)b;
+}
+
+// Ligne de plage : liste à niveaux des points de rupture, dont l'ordre ne change pas entre deux événements
+// Le noeud 0 est la tête de la liste, présent à tous les niveaux ; les noeuds retirés sont réutilisés
+struct LignePlage
+{
+    std::vector<PointRupture> noeuds;
+    std::vector<int> libres;
+    int hauteur = 1;
+    std::uint32_t hasard = 2463534242u;
+
+    LignePlage()
+    {
+        noeuds.resize(1);
+        noeuds[0].niveaux = NIVEAUX;
+        std::fill(noeuds[0].suivants, noeuds[0].suivants + NIVEAUX, -1);
+    }
+
+    bool vide() const
+    {
+        return noeuds[0].suivants[0] == -1;
+    }
+
+    int suivant(int r) const
+    {
+        return noeuds[r].suivants[0];
+    }
+
+    // Point de rupture précédent, 0 (la tête) pour le premier
+    int precedent(int r) const
+    {
+        return noeuds[r].precedents[0];
+    }
+
+    // Insère un point de rupture juste après avant[0] ; avant[k] est le dernier noeud de niveau k
+    // qui le précède, et devient le nouveau noeud à chacun de ses niveaux
+    int insere(int* avant, int gauche, int droite, int trace, bool versDebut)
+    {
+        // Un niveau de plus avec une chance sur quatre (xorshift, reproductible)
+        hasard ^= hasard << 13;
+        hasard ^= hasard >> 17;
+        hasard ^= hasard << 5;
+        int niveaux = 1;
+        for (std::uint32_t tirage = hasard; niveaux < NIVEAUX && (tirage & 3) == 0; tirage >>= 2)
+            niveaux++;
+        for (; hauteur < niveaux; hauteur++)
+            avant[hauteur] = 0;
+
+        int r;
+        if (libres.empty())
+        {
+            r = noeuds.size();
+            noeuds.emplace_back();
+        }
+        else
+        {
+            r = libres.back();
+            libres.pop_back();
+        }
+
+        PointRupture& noeud = noeuds[r];
+        noeud.gauche = gauche;
+        noeud.droite = droite;
+        noeud.trace = trace;
+        noeud.versDebut = versDebut;
+        noeud.evenement = -1;
+        noeud.balayage = std::nan("");
+        noeud.niveaux = niveaux;
+        for (int k=0; k < niveaux; k++)
+        {
+            const int suivant = noeuds[avant[k]].suivants[k];
+            noeud.suivants[k] = suivant;
+            noeud.precedents[k] = avant[k];
+            noeuds[avant[k]].suivants[k] = r;
+            if (suivant != -1)
+                noeuds[suivant].precedents[k] = r;
+            avant[k] = r;
+        }
+        return r;
+    }
+
+    void retire(int r)
+    {
+        const PointRupture& noeud = noeuds[r];
+        for (int k=0; k < noeud.niveaux; k++)
+        {
+            noeuds[noeud.precedents[k]].suivants[k] = noeud.suivants[k];
+            if (noeud.suivants[k] != -1)
+                noeuds[noeud.suivants[k]].precedents[k] = noeud.precedents[k];
+        }
+        libres.push_back(r);
+    }
+};
+
+template <typename T>
+bool construitDiagrammeFortune(const std::vector<Point<T>>& points, Diagramme& diagramme)
+{
+    typedef Predicats<T> Noyau;
+
+    diagramme.sommets.clear();
+    diagramme.indices.clear();
+    diagramme.aretes.clear();
+    diagramme.debuts.assign(points.size() + 1, 0);
+    for (const Point<T>& P : points)
+    {
+        if (!Noyau::dansLimites(P.x, P.y))
+            return false;
+    }
+    if (points.empty())
+        return true;
+
+    // Le balayage travaille sur les positions relatives au coin bas gauche de la boîte englobante,
+    // que l'on ne rajoute qu'aux sommets du diagramme
+    T minX = points[0].x, minY = points[0].y;
+    for (const Point<T>& P : points)
+    {
+        minX = std::min(minX, P.x);
+        minY = std::min(minY, P.y);
+    }
+    std::vector<SommetVoronoi> relatifs(points.size());
+    for (size_t p=0; p < points.size(); p++)
+        relatifs[p] = {ecart(points[p].x, minX), ecart(points[p].y, minY)};
+    const double origineX = (double)minX, origineY = (double)minY;
+
+    // Les sites dans l'ordre (y, x) du balayage ; entre des points confondus, on garde le plus petit indice
+    std::vector<int> sites(points.size());
+    std::iota(sites.begin(), sites.end(), 0);
+    std::sort(sites.begin(), sites.end(), [&](int a, int b){
+        if (points[a].y != points[b].y)
+            return points[a].y < points[b].y;
+        if (points[a].x != points[b].x)
+            return points[a].x < points[b].x;
+        return a < b;
+    });
+    sites.erase(std::unique(sites.begin(), sites.end(), [&](int a, int b){ return points[a] == points[b]; }), sites.end());
+
+    // Chaque point de rupture de la ligne de plage repère l'arc à sa droite ; le premier arc n'a pas de
+    // point de rupture à sa gauche, et tant qu'il est seul, premier garde son site
+    double balayage = 0;
+    LignePlage plage;
+    int premier = -1;
+
+    // Abscisse d'un point de rupture à la position courante du balayage
+    auto position = [&](int r){
+        PointRupture& noeud = plage.noeuds[r];
+        if (noeud.balayage != balayage)
+        {
+            noeud.x = abscisse(relatifs[noeud.gauche], relatifs[noeud.droite], balayage);
+            noeud.balayage = balayage;
+        }
+        return noeud.x;
+    };
+
+    // Un sommet par triangle de Delaunay et une trace par arête : au plus 2 n et 3 n
+    std::vector<Trace> traces;
+    std::vector<Disparition> disparitions;
+    std::vector<int> disparitionsLibres;
+    traces.reserve(3 * sites.size());
+    diagramme.sommets.reserve(2 * sites.size());
+    std::priority_queue<EvenementCercle> file;
+
+    // Les arcs de part et d'autre de l'arc à droite de r se rapprochent si les trois sites tournent
+    // dans le sens direct : l'arc disparaît alors en haut du cercle des trois sites
+    auto verifie = [&](int r){
+        const int suivant = plage.suivant(r);
+        if (r == 0 || suivant == -1)
+            return;
+        const int u = plage.noeuds[r].gauche, v = plage.noeuds[r].droite, w = plage.noeuds[suivant].droite;
+        if (u == w)
+            return;
+        const Point<T>& A = points[u];
+        const Point<T>& B = points[v];
+        const Point<T>& C = points[w];
+        if (Noyau::orient(A.x, A.y, B.x, B.y, C.x, C.y) <= 0)
+            return;
+
+        // Les numéros des événements sortis de la file sont réutilisés : il n'y en a jamais beaucoup en attente
+        int numero;
+        if (disparitionsLibres.empty())
+        {
+            numero = disparitions.size();
+            disparitions.emplace_back();
+        }
+        else
+        {
+            numero = disparitionsLibres.back();
+            disparitionsLibres.pop_back();
+        }
+
+        const SommetVoronoi O = centre(relatifs[u], relatifs[v], relatifs[w]);
+        const double rayon = std::sqrt((O.x - relatifs[u].x) * (O.x - relatifs[u].x) + (O.y - relatifs[u].y) * (O.y - relatifs[u].y));
+        plage.noeuds[r].evenement = numero;
+        disparitions[numero] = {r, O};
+        file.push({O.y + rayon, O.x, numero});
+    };
+    auto invalide = [&](int r){
+        PointRupture& noeud = plage.noeuds[r];
+        if (r != 0 && noeud.evenement != -1)
+            disparitions[noeud.evenement].rupture = -1;
+        noeud.evenement = -1;
+    };
+    auto termine = [&](int r, int sommet){
+        Trace& trace = traces[plage.noeuds[r].trace];
+        (plage.noeuds[r].versDebut ? trace.debut : trace.fin) = sommet;
+    };
+
+    // L'arc à droite de r disparaît : ses deux points de rupture finissent au centre du cercle et les arcs
+    // voisins se rejoignent en un point de rupture qui part de ce sommet ; il prend la place de r, qui
+    // ne change pas de rang sur la ligne de plage
+    auto disparait = [&](Disparition disparition){
+        const int r = disparition.rupture, suivant = plage.suivant(r);
+        const int u = plage.noeuds[r].gauche, w = plage.noeuds[suivant].droite;
+
+        const int sommet = diagramme.sommets.size();
+        diagramme.sommets.push_back({disparition.centre.x + origineX, disparition.centre.y + origineY});
+
+        termine(r, sommet);
+        termine(suivant, sommet);
+        invalide(suivant);
+        invalide(plage.precedent(r));
+        plage.retire(suivant);
+
+        traces.push_back({u, w, sommet, -1});
+        PointRupture& noeud = plage.noeuds[r];
+        noeud.droite = w;
+        noeud.trace = traces.size() - 1;
+        noeud.versDebut = false;
+        noeud.evenement = -1;
+        noeud.balayage = std::nan("");
+        verifie(plage.precedent(r));
+        verifie(r);
+    };
+
+    // Le prochain événement de cercle, s'il n'a pas été invalidé entre-temps
+    auto traiteEvenement = [&](){
+        const int numero = file.top().numero;
+        file.pop();
+        disparitionsLibres.push_back(numero);
+        if (disparitions[numero].rupture != -1)
+            disparait(disparitions[numero]);
+    };
+
+    int avant[NIVEAUX];
+    for (int p : sites)
+    {
+        const SommetVoronoi& P = relatifs[p];
+
+        // Les cercles dont le haut passe avant le site
+        while (!file.empty() && (file.top().y < P.y || (file.top().y == P.y && file.top().x <= P.x)))
+            traiteEvenement();
+        balayage = P.y;
+
+        if (premier == -1)
+        {
+            premier = p;
+            continue;
+        }
+
+        // L'arc au-dessus du site : celui à droite du dernier point de rupture à gauche du site,
+        // que l'on cherche en descendant les niveaux depuis la tête
+        int r = 0;
+        for (int k=plage.hauteur - 1; k >= 0; k--)
+        {
+            for (int suivant = plage.noeuds[r].suivants[k]; suivant != -1 && position(suivant) < P.x; suivant = plage.noeuds[r].suivants[k])
+                r = suivant;
+            avant[k] = r;
+        }
+        const int droite = plage.suivant(r);
+        const int a = r != 0 ? plage.noeuds[r].droite : (droite != -1 ? plage.noeuds[droite].gauche : premier);
+
+        // Les premiers sites à la même hauteur ne font que s'aligner, séparés par des arêtes verticales
+        traces.push_back({a, p, -1, -1});
+        const int trace = traces.size() - 1;
+        if (relatifs[a].y == P.y)
+        {
+            plage.insere(avant, a, p, trace, false);
+            continue;
+        }
+
+        // Sinon l'arc de a est coupé en deux par celui du site, qui s'élargit des deux côtés de la même arête
+        invalide(r);
+        plage.insere(avant, a, p, trace, false);
+        const int nouveau = plage.insere(avant, p, a, trace, true);
+        verifie(r);
+        verifie(nouveau);
+    }
+    while (!file.empty())
+        traiteEvenement();
+
+    // Les arêtes finies, puis chaque cellule en suivant ses arêtes le site à gauche : une cellule
+    // qui touche une arête infinie n'est pas bornée
+    bool fermees = true;
+    std::vector<char> ouverte(points.size(), 0);
+    std::vector<int> debuts(points.size() + 1, 0);
+    diagramme.aretes.reserve(traces.size());
+    for (const Trace& trace : traces)
+    {
+        if (trace.debut != -1 && trace.fin != -1)
+            diagramme.aretes.push_back({trace.debut, trace.fin, trace.gauche, trace.droite});
+        else
+            ouverte[trace.gauche] = ouverte[trace.droite] = 1;
+        debuts[trace.gauche + 1]++;
+        debuts[trace.droite + 1]++;
+    }
+    for (size_t s=0; s < points.size(); s++)
+        debuts[s + 1] += debuts[s];
+
+    std::vector<std::pair<int, int>> cotes(debuts.back());
+    std::vector<int> place(debuts.begin(), debuts.end() - 1);
+    for (const Trace& trace : traces)
+    {
+        cotes[place[trace.gauche]++] = {trace.debut, trace.fin};
+        cotes[place[trace.droite]++] = {trace.fin, trace.debut};
+    }
+
+    for (size_t s=0; s < points.size(); s++)
+    {
+        diagramme.debuts[s] = diagramme.indices.size();
+        if (ouverte[s] || debuts[s] == debuts[s + 1])
+            continue;
+
+        // Le côté qui part d'un sommet se cherche de proche en proche dans une petite cellule,
+        // par dichotomie dans une grande (un site au centre de beaucoup de sites cocycliques)
+        auto premierCote = cotes.begin() + debuts[s], dernierCote = cotes.begin() + debuts[s + 1];
+        const bool trie = dernierCote - premierCote > 16;
+        if (trie)
+            std::sort(premierCote, dernierCote);
+
+        // Un sommet dédoublé par l'arrondi (sites presque cocycliques) coupe le tour de la cellule,
+        // qui ne se referme pas : on la laisse vide, comme une cellule ouverte, et on le signale
+        int sommet = premierCote->first;
+        for (int k=debuts[s]; k < debuts[s + 1] && sommet != -1; k++)
+        {
+            diagramme.indices.push_back(sommet);
+            auto cote = trie ? std::lower_bound(premierCote, dernierCote, std::make_pair(sommet, -1))
+                             : std::find_if(premierCote, dernierCote, [&](const std::pair<int, int>& c){ return c.first == sommet; });
+            sommet = cote != dernierCote && cote->first == sommet ? cote->second : -1;
+        }
+        if (sommet != premierCote->first)
+        {
+            diagramme.indices.resize(diagramme.debuts[s]);
+            fermees = false;
+        }
+    }
+    diagramme.debuts[points.size()] = diagramme.indices.size();
+    return fermees;
+}
+
+template bool construitDiagrammeFortune<int>(const std::vector<Point<int>>&, Diagramme&);
+template bool construitDiagrammeFortune<float>(const std::vector<Point<float>>&, Diagramme&);
+template bool construitDiagrammeFortune<double>(const std::vector<Point<double>>&, Diagramme&);
+#ifdef __SIZEOF_INT128__
+template bool construitDiagrammeFortune<std::int64_t>(const std::vector<Point<std::int64_t>>&, Diagramme&);
+#endif
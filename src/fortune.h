@@ -0,0 +1,22 @@
+#ifndef FORTUNE_H
+#define FORTUNE_H
+#include "geometry.h"
+#include "voronoi.h"
+#include <vector>
+
+// Construit le diagramme compact des points par le balayage de Fortune, sans passer par la triangulation :
+// une droite monte selon y, la ligne de plage (les arcs de parabole juste sous la droite) est rangée
+// dans une liste à niveaux et les événements de site et de cercle sortent d'une file de priorité
+// Le diagramme est le même que celui de construitDiagramme sur la triangulation des points : un sommet
+// par triangle de Delaunay (à l'arrondi près), les mêmes cellules et les mêmes arêtes finies, numérotés
+// autrement ; entre des points confondus, seul celui de plus petit indice a une cellule
+// Le test de convergence des arcs passe par le prédicat exact, les positions sur la ligne de plage sont
+// calculées en double, relativement au coin bas gauche des points (soustrait dans le type des coordonnées,
+// exact pour les entiers) pour ne pas perdre de bits loin de l'origine
+// Retourne false si un point sort de la plage supportée par les prédicats, ou si une cellule ne se referme
+// pas (un sommet dédoublé par l'arrondi entre des sites presque cocycliques) : elle est alors laissée vide
+// et le reste du diagramme est construit (instanciée pour les mêmes types de coordonnées que la triangulation)
+template <typename T>
+bool construitDiagrammeFortune(const std::vector<Point<T>>& points, Diagramme& diagramme);
+
+#endif
@@ -0,0 +1,280 @@
+#include "generators.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+const char* nomDistribution(Distribution distribution)
+{
+    switch (distribution)
+    {
+    case Distribution::Uniforme: return "uniforme";
+    case Distribution::Poisson: return "poisson";
+    case Distribution::Amas: return "amas";
+    case Distribution::Grille: return "grille";
+    case Distribution::Cercle: return "cercle";
+    case Distribution::Doublons: return "doublons";
+    }
+    return "";
+}
+
+// Convertit une position dans le type des coordonnées (arrondie vers le bas pour des entiers)
+template <typename T>
+static Point<T> convertit(double x, double y)
+{
+    if constexpr (std::is_integral<T>::value)
+        return {static_cast<T>(std::floor(x)), static_cast<T>(std::floor(y))};
+    else
+        return {static_cast<T>(x), static_cast<T>(y)};
+}
+
+// Échantillonnage de Poisson de Bridson : chaque point actif essaie de placer des voisins
+// dans l'anneau [r, 2r] autour de lui, une grille de cases de côté r / sqrt(2) donne les conflits
+static std::vector<std::pair<double, double>> poisson(double largeur, double hauteur, double r, std::mt19937& generateur)
+{
+    const double cote = r / std::sqrt(2.0);
+    const int colonnes = std::max(1, (int)std::ceil(largeur / cote));
+    const int lignes = std::max(1, (int)std::ceil(hauteur / cote));
+    std::vector<int> grille((size_t)colonnes * lignes, -1);
+
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    std::vector<std::pair<double, double>> points;
+    std::vector<int> actifs;
+
+    auto ajoute = [&](double x, double y)
+    {
+        int c = std::min(colonnes - 1, (int)(x / cote));
+        int l = std::min(lignes - 1, (int)(y / cote));
+        grille[(size_t)l * colonnes + c] = points.size();
+        actifs.push_back(points.size());
+        points.push_back({x, y});
+    };
+
+    auto libre = [&](double x, double y)
+    {
+        int c = std::min(colonnes - 1, (int)(x / cote));
+        int l = std::min(lignes - 1, (int)(y / cote));
+        for (int j = std::max(0, l - 2); j <= std::min(lignes - 1, l + 2); j++)
+        {
+            for (int i = std::max(0, c - 2); i <= std::min(colonnes - 1, c + 2); i++)
+            {
+                int k = grille[(size_t)j * colonnes + i];
+                if (k == -1)
+                    continue;
+                double dx = points[k].first - x, dy = points[k].second - y;
+                if (dx * dx + dy * dy < r * r)
+                    return false;
+            }
+        }
+        return true;
+    };
+
+    // (les tirages sont séquencés un par un pour rester reproductibles d'un compilateur à l'autre)
+    double x0 = u(generateur) * largeur;
+    ajoute(x0, u(generateur) * hauteur);
+    while (!actifs.empty())
+    {
+        size_t a = (size_t)(u(generateur) * actifs.size()) % actifs.size();
+        const std::pair<double, double> centre = points[actifs[a]];
+
+        bool place = false;
+        for (int essai=0; essai < 30 && !place; essai++)
+        {
+            double angle = u(generateur) * 6.283185307179586;
+            double distance = r * (1.0 + u(generateur));
+            double x = centre.first + distance * std::cos(angle);
+            double y = centre.second + distance * std::sin(angle);
+            if (x >= 0 && x < largeur && y >= 0 && y < hauteur && libre(x, y))
+            {
+                ajoute(x, y);
+                place = true;
+            }
+        }
+
+        // Aucun voisin possible : ce point n'est plus actif
+        if (!place)
+        {
+            actifs[a] = actifs.back();
+            actifs.pop_back();
+        }
+    }
+    return points;
+}
+
+// Rayon entier qui a beaucoup de points entiers sur son cercle : produit de nombres premiers
+// congrus à 1 modulo 4, le plus grand qui tienne dans rayonMax (0 s'il n'y en a pas)
+static long long rayonCocyclique(double rayonMax)
+{
+    const int premiers[] = {5, 13, 17, 29, 37, 41, 53, 61};
+    long long rayon = 0;
+    for (int p : premiers)
+    {
+        long long suivant = rayon == 0 ? p : rayon * p;
+        if (suivant > rayonMax)
+            break;
+        rayon = suivant;
+    }
+    return rayon;
+}
+
+template <typename T>
+std::vector<Point<T>> generePoints(Distribution distribution, std::size_t n, double largeur, double hauteur, unsigned graine)
+{
+    std::mt19937 generateur(graine);
+    std::uniform_real_distribution<double> ux(0.0, largeur);
+    std::uniform_real_distribution<double> uy(0.0, hauteur);
+    std::vector<Point<T>> points;
+    points.reserve(n);
+
+    switch (distribution)
+    {
+    case Distribution::Uniforme:
+        for (size_t i=0; i < n; i++)
+        {
+            double x = ux(generateur);
+            points.push_back(convertit<T>(x, uy(generateur)));
+        }
+        break;
+
+    case Distribution::Poisson:
+    {
+        // Une fois saturé, l'échantillonnage place environ 0,68 point par r² : on vise un peu plus
+        // de n points, puis on en garde n au hasard (on resserre le rayon tant qu'il en manque)
+        double r = std::sqrt(0.6 * largeur * hauteur / std::max<size_t>(n, 1));
+        const double rayonMin = 1e-9 * std::max(largeur, hauteur);
+        std::vector<std::pair<double, double>> tires;
+        while (r > rayonMin)
+        {
+            tires = poisson(largeur, hauteur, r, generateur);
+            if (tires.size() >= n)
+                break;
+            r *= 0.9;
+        }
+
+        std::shuffle(tires.begin(), tires.end(), generateur);
+        for (size_t i=0; i < n && i < tires.size(); i++)
+            points.push_back(convertit<T>(tires[i].first, tires[i].second));
+
+        // Dans un rectangle dégénéré (sans aire), le rayon s'annule avant d'avoir assez de points :
+        // on complète par des tirages uniformes pour rendre toujours n points
+        while (points.size() < n)
+        {
+            double x = ux(generateur);
+            points.push_back(convertit<T>(x, uy(generateur)));
+        }
+        break;
+    }
+
+    case Distribution::Amas:
+    {
+        // Environ un amas pour mille points, d'écart type proportionnel à leur espacement
+        size_t nombre = std::max<size_t>(1, std::min<size_t>(1000, n / 1000));
+        std::vector<std::pair<double, double>> centres(nombre);
+        for (auto& c : centres)
+        {
+            double x = ux(generateur);
+            c = {x, uy(generateur)};
+        }
+        // Dans un rectangle sans aire, l'écart type suit le côté qui n'est pas nul (1 si les deux le sont) :
+        // la loi normale demande un écart type strictement positif
+        const double cote = std::min(largeur, hauteur) > 0 ? std::min(largeur, hauteur) : std::max(largeur, hauteur);
+        const double ecart = cote > 0 ? 0.25 * cote / std::sqrt((double)nombre) : 1.0;
+        std::normal_distribution<double> g(0.0, ecart);
+        // Les points qui débordent sont ramenés sur le bord du rectangle
+        const double maxX = std::nextafter(largeur, 0.0), maxY = std::nextafter(hauteur, 0.0);
+        for (size_t i=0; i < n; i++)
+        {
+            const auto& c = centres[i % nombre];
+            double x = std::min(maxX, std::max(0.0, c.first + g(generateur)));
+            double y = std::min(maxY, std::max(0.0, c.second + g(generateur)));
+            points.push_back(convertit<T>(x, y));
+        }
+        break;
+    }
+
+    case Distribution::Grille:
+    {
+        // Grille de pas entier (ou 1 si le rectangle est trop petit), dans un ordre aléatoire
+        // Un rectangle sans hauteur n'a qu'une ligne, un rectangle sans largeur qu'une colonne,
+        // et le côté nul ne limite pas le pas
+        size_t colonnes = n;
+        if (largeur <= 0)
+            colonnes = 1;
+        else if (hauteur > 0)
+            colonnes = (size_t)std::min((double)n, std::ceil(std::sqrt(n * largeur / hauteur)));
+        colonnes = std::max<size_t>(1, colonnes);
+        size_t lignes = (n + colonnes - 1) / colonnes;
+        const double infini = std::numeric_limits<double>::infinity();
+        double pas = std::min(largeur > 0 ? largeur / colonnes : infini, hauteur > 0 ? hauteur / lignes : infini);
+        pas = pas < infini ? std::max(1.0, std::floor(pas)) : 1.0;
+        for (size_t i=0; i < n; i++)
+            points.push_back(convertit<T>((i % colonnes) * pas, (i / colonnes) * pas));
+        std::shuffle(points.begin(), points.end(), generateur);
+        break;
+    }
+
+    case Distribution::Cercle:
+    {
+        const double cx = std::floor(largeur / 2), cy = std::floor(hauteur / 2);
+        const double rayonMax = std::min(cx, cy) - 1;
+
+        // En coordonnées entières, on prend d'abord les points entiers du cercle, au hasard
+        if constexpr (std::is_integral<T>::value)
+        {
+            long long R = rayonCocyclique(rayonMax);
+            for (long long x = -R; x <= R; x++)
+            {
+                long long y2 = R * R - x * x;
+                long long y = std::llround(std::sqrt((double)y2));
+                if (y * y != y2)
+                    continue;
+                points.push_back({static_cast<T>(cx + x), static_cast<T>(cy + y)});
+                if (y != 0)
+                    points.push_back({static_cast<T>(cx + x), static_cast<T>(cy - y)});
+            }
+            std::shuffle(points.begin(), points.end(), generateur);
+            if (points.size() > n)
+                points.resize(n);
+        }
+
+        // On complète avec des points du cercle arrondis, presque cocycliques
+        std::uniform_real_distribution<double> angle(0.0, 6.283185307179586);
+        while (points.size() < n)
+        {
+            double a = angle(generateur);
+            double x = cx + rayonMax * std::cos(a);
+            double y = cy + rayonMax * std::sin(a);
+            if constexpr (std::is_integral<T>::value)
+                points.push_back({static_cast<T>(std::llround(x)), static_cast<T>(std::llround(y))});
+            else
+                points.push_back(convertit<T>(x, y));
+        }
+        std::shuffle(points.begin(), points.end(), generateur);
+        break;
+    }
+
+    case Distribution::Doublons:
+    {
+        // La première moitié est tirée au hasard, la seconde répète des points de la première
+        size_t uniques = (n + 1) / 2;
+        for (size_t i=0; i < uniques; i++)
+        {
+            double x = ux(generateur);
+            points.push_back(convertit<T>(x, uy(generateur)));
+        }
+        for (size_t i=uniques; i < n; i++)
+            points.push_back(points[generateur() % uniques]);
+        std::shuffle(points.begin(), points.end(), generateur);
+        break;
+    }
+    }
+
+    return points;
+}
+
+template std::vector<Point<int>> generePoints<int>(Distribution, std::size_t, double, double, unsigned);
+template std::vector<Point<std::int64_t>> generePoints<std::int64_t>(Distribution, std::size_t, double, double, unsigned);
+template std::vector<Point<float>> generePoints<float>(Distribution, std::size_t, double, double, unsigned);
+template std::vector<Point<double>> generePoints<double>(Distribution, std::size_t, double, double, unsigned);
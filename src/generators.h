@@ -0,0 +1,29 @@
+#ifndef GENERATORS_H
+#define GENERATORS_H
+#include "geometry.h"
+#include <cstddef>
+#include <vector>
+
+// Répartitions de points synthétiques, pour les essais de charge et les mesures
+enum class Distribution
+{
+    Uniforme,       // tirage uniforme dans le rectangle
+    Poisson,        // échantillonnage de Poisson (deux points jamais trop proches)
+    Amas,           // amas gaussiens
+    Grille,         // grille régulière : beaucoup de points cocycliques, pire cas du test du cercle
+    Cercle,         // points sur un même cercle (exactement cocycliques en coordonnées entières tant que possible)
+    Doublons        // tirage uniforme où la moitié des points répète un point déjà tiré
+};
+
+// Nom court de la répartition (pour les journaux et le JSON des mesures)
+const char* nomDistribution(Distribution distribution);
+
+// Génère exactement n points dans le rectangle [0, largeur) x [0, hauteur) (des points confondus
+// sont possibles, sauf pour Poisson dans un rectangle assez grand devant n)
+// Le résultat ne dépend que des paramètres : une même graine redonne les mêmes points
+// (avec la même bibliothèque standard, dont les lois de tirage ne sont pas normalisées)
+// (instanciée pour les mêmes types de coordonnées que la triangulation)
+template <typename T>
+std::vector<Point<T>> generePoints(Distribution distribution, std::size_t n, double largeur, double hauteur, unsigned graine = 0);
+
+#endif
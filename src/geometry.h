@@ -0,0 +1,24 @@
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+// Point du plan, paramétré par le type de ses coordonnées
+template <typename T>
+struct Point
+{
+    T x, y;
+
+    bool operator==(const Point& other) const
+    {
+        return x == other.x and y == other.y;
+    }
+};
+
+// Coordonnées entières de l'écran
+typedef Point<int> Coords;
+
+struct Segment
+{
+    Coords p1, p2;
+};
+
+#endif
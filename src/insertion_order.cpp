@@ -0,0 +1,134 @@
+#include "insertion_order.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+
+// Nombre de bits par axe de la grille sur laquelle on calcule la courbe de Hilbert
+static const int BITS_HILBERT = 16;
+
+// Position de la case (x, y) le long de la courbe de Hilbert d'une grille de côté n
+static unsigned long long indiceHilbert(unsigned n, unsigned x, unsigned y)
+{
+    unsigned long long d = 0;
+    for (unsigned s = n / 2; s > 0; s /= 2)
+    {
+        unsigned rx = (x & s) > 0;
+        unsigned ry = (y & s) > 0;
+        d += (unsigned long long)s * s * ((3 * rx) ^ ry);
+
+        // On tourne le quadrant pour que la courbe reste continue
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+// Case de la grille de côté n pour une coordonnée déjà mise à l'échelle ; une coordonnée infinie
+// ou NaN (que les prédicats refuseront ensuite) ne doit pas rendre la conversion indéfinie
+static unsigned surGrille(double v, unsigned n)
+{
+    if (!(v >= 0))
+        return 0;
+    return v < n - 1 ? (unsigned)v : n - 1;
+}
+
+// Trie les indices [debut, fin) selon la courbe de Hilbert de la boîte englobante des points
+template <typename T>
+static void trieHilbert(const std::vector<Point<T>>& points, std::vector<int>::iterator debut, std::vector<int>::iterator fin)
+{
+    if (fin - debut < 2)
+        return;
+
+    // On cherche la boîte englobante
+    T minX = points[*debut].x, maxX = minX;
+    T minY = points[*debut].y, maxY = minY;
+    for (auto it = debut; it != fin; ++it)
+    {
+        minX = std::min(minX, points[*it].x);
+        maxX = std::max(maxX, points[*it].x);
+        minY = std::min(minY, points[*it].y);
+        maxY = std::max(maxY, points[*it].y);
+    }
+
+    // On ramène chaque point sur la grille et on calcule sa clé une seule fois
+    const unsigned n = 1u << BITS_HILBERT;
+    const double etendue = std::max(1.0, std::max((double)maxX - minX, (double)maxY - minY));
+    const double echelle = (n - 1) / etendue;
+
+    std::vector<std::pair<unsigned long long, int>> cles;
+    cles.reserve(fin - debut);
+    for (auto it = debut; it != fin; ++it)
+    {
+        unsigned x = surGrille(((double)points[*it].x - minX) * echelle, n);
+        unsigned y = surGrille(((double)points[*it].y - minY) * echelle, n);
+        cles.push_back({indiceHilbert(n, x, y), *it});
+    }
+
+    std::sort(cles.begin(), cles.end());
+    for (size_t i=0; i < cles.size(); i++)
+        debut[i] = cles[i].second;
+}
+
+template <typename T>
+std::vector<int> ordreInsertion(const std::vector<Point<T>>& points, OrdreInsertion ordre, unsigned graine)
+{
+    std::vector<int> permutation(points.size());
+    for (size_t i=0; i < points.size(); i++)
+        permutation[i] = i;
+
+    switch (ordre)
+    {
+    case OrdreInsertion::Lignes:
+        std::stable_sort(permutation.begin(), permutation.end(), [&](int a, int b){ return compareCoords(points[a], points[b]); });
+        break;
+
+    case OrdreInsertion::Hilbert:
+        trieHilbert(points, permutation.begin(), permutation.end());
+        break;
+
+    case OrdreInsertion::BRIO:
+    {
+        // On mélange les points puis on les découpe en tours : le dernier tour contient
+        // la moitié des points, celui d'avant le quart, etc.
+        // Le mélange de Fisher-Yates est écrit ici et tire directement dans mt19937, dont la suite est
+        // normalisée : std::shuffle change d'une bibliothèque standard à l'autre, et une même graine
+        // doit redonner le même ordre partout
+        std::mt19937 generateur(graine);
+        for (size_t i=permutation.size(); i > 1; i--)
+        {
+            // Tirage sans biais dans [0, i) : on rejette les 2^32 mod i plus petites valeurs
+            const std::uint32_t borne = i;
+            const std::uint32_t rejet = (0u - borne) % borne;
+            std::uint32_t tirage;
+            do
+                tirage = generateur();
+            while (tirage < rejet);
+            std::swap(permutation[i - 1], permutation[tirage % borne]);
+        }
+
+        size_t fin = permutation.size();
+        while (fin > 0)
+        {
+            size_t debut = fin > 64 ? fin / 2 : 0;
+            trieHilbert(points, permutation.begin() + debut, permutation.begin() + fin);
+            fin = debut;
+        }
+        break;
+    }
+    }
+
+    return permutation;
+}
+
+template std::vector<int> ordreInsertion<int>(const std::vector<Point<int>>&, OrdreInsertion, unsigned);
+template std::vector<int> ordreInsertion<float>(const std::vector<Point<float>>&, OrdreInsertion, unsigned);
+template std::vector<int> ordreInsertion<double>(const std::vector<Point<double>>&, OrdreInsertion, unsigned);
+template std::vector<int> ordreInsertion<std::int64_t>(const std::vector<Point<std::int64_t>>&, OrdreInsertion, unsigned);
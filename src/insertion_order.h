@@ -0,0 +1,30 @@
+#ifndef INSERTION_ORDER_H
+#define INSERTION_ORDER_H
+#include "geometry.h"
+#include <vector>
+
+// Ordre dans lequel les points sont insérés dans la triangulation
+enum class OrdreInsertion
+{
+    Lignes,     // tri par y puis par x (l'ancien ordre)
+    Hilbert,    // parcours de la courbe de Hilbert
+    BRIO        // tours aléatoires de taille croissante, chacun trié selon Hilbert
+};
+
+// Tri par y puis par x
+template <typename T>
+bool compareCoords(const Point<T>& point1, const Point<T>& point2)
+{
+    if (point1.y == point2.y)
+        return point1.x < point2.x;
+    return point1.y < point2.y;
+}
+
+// Calcule la permutation des indices de points dans l'ordre d'insertion choisi
+// Les points eux-mêmes ne sont pas déplacés, leurs indices restent stables
+// Pour BRIO, une même graine donne le même ordre quelle que soit la bibliothèque standard
+// (instanciée pour les mêmes types de coordonnées que la triangulation)
+template <typename T>
+std::vector<int> ordreInsertion(const std::vector<Point<T>>& points, OrdreInsertion ordre, unsigned graine = 0);
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef LIBVORONOI_H
+#define LIBVORONOI_H
+#include "geometry.h"
+#include "delaunay.h"
+#include "division.h"
+#include "fortune.h"
+#include "generators.h"
+#include "insertion_order.h"
+#include "voronoi.h"
+#include <vector>
+
+// Point d'entrée de la bibliothèque, sans aucune dépendance à SDL :
+// - construction de la triangulation à partir des points (construitMaillage), sur un ou plusieurs threads,
+//   par insertion ou par diviser pour régner (trianguleDivision)
+// - mise à jour locale du maillage (ajoutePoint, retireSommet, deplaceSommet, deplaceSommets)
+// - interrogation du maillage (BasicMesh, localiseTriangle, insereSommet)
+// - extraction des cellules du diagramme (construitCellules, construitCellule pour un site)
+//   et des cellules découpées par un cadre (construitCellulesBornees, construitCelluleBornee)
+// - diagramme compact à sommets partagés, cellules et arêtes (construitDiagramme), ou directement
+//   depuis les points par le balayage de Fortune (construitDiagrammeFortune)
+// - génération de points reproductibles pour les essais (generePoints)
+// Tout est disponible pour les coordonnées int, std::int64_t, float et double.
+
+// Triangule les points dans l'ordre d'insertion choisi, sans toucher à l'ordre des points
+// Si garderInfinis est faux, on retire les triangles infinis une fois la triangulation finie
+// Avec plus d'un thread (0 pour tous les coeurs), on passe par trianguleDelaunayParallele,
+// qui insère toujours les points de chaque bande dans l'ordre de Hilbert
+// Le moteur Division ignore l'ordre d'insertion : il trie lui-même les points selon x
+// temps reçoit la durée des étapes de la triangulation par bandes s'il n'est pas nul
+// Retourne false si un point sort de la plage de coordonnées supportée
+template <typename T>
+bool construitMaillage(BasicMesh<T>& mesh, const std::vector<Point<T>>& points, OrdreInsertion ordre = OrdreInsertion::Hilbert, bool garderInfinis = false, unsigned graine = 0, int nombreThreads = 1,
+    MoteurDelaunay moteur = MoteurDelaunay::Insertion, TempsParallele* temps = nullptr)
+{
+    // On vérifie les points avant de calculer l'ordre d'insertion, qui les ramène sur une grille
+    if (!pointsDansLimites(points))
+    {
+        mesh.clear();
+        return false;
+    }
+
+    bool valide;
+    if (moteur == MoteurDelaunay::Division)
+        valide = trianguleDivision(mesh, points, nombreThreads);
+    else if (nombreThreads != 1)
+        valide = trianguleDelaunayParallele(mesh, points, nombreThreads, temps);
+    else
+        valide = trianguleDelaunay(mesh, points, ordreInsertion(points, ordre, graine));
+    if (!garderInfinis)
+        retireTrianglesInfinis(mesh);
+    return valide;
+}
+
+#endif
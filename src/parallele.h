@@ -0,0 +1,32 @@
+#ifndef PARALLELE_H
+#define PARALLELE_H
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Outils internes de la bibliothèque pour répartir un travail sur plusieurs threads
+
+// Nombre de tranches pour traiter n éléments : 0 thread demande tous les coeurs, et chaque tranche
+// garde au moins minimum éléments pour que le lancement d'un thread reste rentable
+inline int nombreTranches(int nombreThreads, size_t n, size_t minimum = 4096)
+{
+    if (nombreThreads <= 0)
+        nombreThreads = std::max(1u, std::thread::hardware_concurrency());
+    return (int)std::max<size_t>(1, std::min<size_t>(nombreThreads, n / minimum));
+}
+
+// Appelle travail(k, debut, fin) pour chacune des tranches égales de [0, n), chacune sur son thread
+// (la première sur le thread appelant) ; les tranches ne partagent rien en écriture
+template <typename Travail>
+void enParallele(int tranches, size_t n, const Travail& travail)
+{
+    std::vector<std::thread> threads;
+    for (int k=1; k < tranches; k++)
+        threads.emplace_back([&travail, k, tranches, n]{ travail(k, n * k / tranches, n * (k + 1) / tranches); });
+    travail(0, 0, n / tranches);
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+#endif
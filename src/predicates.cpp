@@ -0,0 +1,269 @@
+#include "predicates.h"
+#include <cmath>
+
+// Moitié de l'écart entre 1 et le double suivant, et constante de découpage de Dekker
+static const double epsilon = 1.1102230246251565e-16;
+static const double splitter = 134217729.0;
+
+// Bornes d'erreur du calcul rapide
+static const double ccwerrboundA = (3.0 + 16.0 * epsilon) * epsilon;
+static const double iccerrboundA = (10.0 + 96.0 * epsilon) * epsilon;
+
+// Somme exacte : a + b = x + y, x étant l'arrondi et y l'erreur
+static inline void twoSum(double a, double b, double& x, double& y)
+{
+    x = a + b;
+    double bvirt = x - a;
+    double avirt = x - bvirt;
+    double bround = b - bvirt;
+    double around = a - avirt;
+    y = around + bround;
+}
+
+// Découpe a en deux moitiés de 26 bits
+static inline void split(double a, double& hi, double& lo)
+{
+    double c = splitter * a;
+    double abig = c - a;
+    hi = c - abig;
+    lo = a - hi;
+}
+
+// Produit exact : a * b = x + y
+static inline void twoProduct(double a, double b, double& x, double& y)
+{
+    x = a * b;
+    double ahi, alo, bhi, blo;
+    split(a, ahi, alo);
+    split(b, bhi, blo);
+    double err1 = x - ahi * bhi;
+    double err2 = err1 - alo * bhi;
+    double err3 = err2 - ahi * blo;
+    y = alo * blo - err3;
+}
+
+// Une expansion est une somme de doubles qui ne se chevauchent pas, rangés par
+// magnitude croissante : son signe est celui de sa dernière composante.
+
+// h = e + f, en supprimant les composantes nulles ; retourne la longueur de h
+static int expansionSum(int elen, const double* e, int flen, const double* f, double* h)
+{
+    double Q, Qnew, hh;
+    int eindex = 0, findex = 0, hindex = 0;
+    double enow = e[0];
+    double fnow = f[0];
+
+    if ((fnow > enow) == (fnow > -enow))
+    {
+        Q = enow;
+        enow = ++eindex < elen ? e[eindex] : 0.0;
+    }
+    else
+    {
+        Q = fnow;
+        fnow = ++findex < flen ? f[findex] : 0.0;
+    }
+
+    while (eindex < elen && findex < flen)
+    {
+        if ((fnow > enow) == (fnow > -enow))
+        {
+            twoSum(Q, enow, Qnew, hh);
+            enow = ++eindex < elen ? e[eindex] : 0.0;
+        }
+        else
+        {
+            twoSum(Q, fnow, Qnew, hh);
+            fnow = ++findex < flen ? f[findex] : 0.0;
+        }
+        Q = Qnew;
+        if (hh != 0.0)
+            h[hindex++] = hh;
+    }
+    while (eindex < elen)
+    {
+        twoSum(Q, enow, Qnew, hh);
+        enow = ++eindex < elen ? e[eindex] : 0.0;
+        Q = Qnew;
+        if (hh != 0.0)
+            h[hindex++] = hh;
+    }
+    while (findex < flen)
+    {
+        twoSum(Q, fnow, Qnew, hh);
+        fnow = ++findex < flen ? f[findex] : 0.0;
+        Q = Qnew;
+        if (hh != 0.0)
+            h[hindex++] = hh;
+    }
+
+    if (Q != 0.0 || hindex == 0)
+        h[hindex++] = Q;
+    return hindex;
+}
+
+// h = b * e, en supprimant les composantes nulles ; retourne la longueur de h
+static int scaleExpansion(int elen, const double* e, double b, double* h)
+{
+    double Q, sum, hh, product1, product0;
+    int hindex = 0;
+
+    twoProduct(e[0], b, Q, hh);
+    if (hh != 0.0)
+        h[hindex++] = hh;
+    for (int eindex = 1; eindex < elen; eindex++)
+    {
+        twoProduct(e[eindex], b, product1, product0);
+        twoSum(Q, product0, sum, hh);
+        if (hh != 0.0)
+            h[hindex++] = hh;
+        twoSum(product1, sum, Q, hh);
+        if (hh != 0.0)
+            h[hindex++] = hh;
+    }
+
+    if (Q != 0.0 || hindex == 0)
+        h[hindex++] = Q;
+    return hindex;
+}
+
+static void negate(int elen, double* e)
+{
+    for (int i=0; i < elen; i++)
+        e[i] = -e[i];
+}
+
+// Déterminant 2x2 exact : ax * by - bx * ay, sur 4 composantes
+static int cross(double ax, double ay, double bx, double by, double* h)
+{
+    double p[2], q[2];
+    twoProduct(ax, by, p[1], p[0]);
+    twoProduct(bx, ay, q[1], q[0]);
+    negate(2, q);
+    return expansionSum(2, p, 2, q, h);
+}
+
+static double orient2dExact(double ax, double ay, double bx, double by, double cx, double cy)
+{
+    double ab[4], bc[4], ca[4], t[8], det[12];
+    int ablen = cross(ax, ay, bx, by, ab);
+    int bclen = cross(bx, by, cx, cy, bc);
+    int calen = cross(cx, cy, ax, ay, ca);
+    int tlen = expansionSum(ablen, ab, bclen, bc, t);
+    int detlen = expansionSum(tlen, t, calen, ca, det);
+    return det[detlen - 1];
+}
+
+double orient2d(double ax, double ay, double bx, double by, double cx, double cy)
+{
+    double detleft = (ax - cx) * (by - cy);
+    double detright = (ay - cy) * (bx - cx);
+    double det = detleft - detright;
+    double detsum;
+
+    if (detleft > 0.0)
+    {
+        if (detright <= 0.0)
+            return det;
+        detsum = detleft + detright;
+    }
+    else if (detleft < 0.0)
+    {
+        if (detright >= 0.0)
+            return det;
+        detsum = -detleft - detright;
+    }
+    else
+    {
+        return det;
+    }
+
+    double errbound = ccwerrboundA * detsum;
+    if (det >= errbound || -det >= errbound)
+        return det;
+
+    return orient2dExact(ax, ay, bx, by, cx, cy);
+}
+
+// Ajoute à det la quantité signe * (px² + py²) * o, o étant une expansion
+static int ajouteRelevement(double px, double py, const double* o, int olen, bool negatif, double* det, int detlen, double* resultat)
+{
+    double x[24], xx[48], y[24], yy[48], l[96];
+    int xlen = scaleExpansion(olen, o, px, x);
+    int xxlen = scaleExpansion(xlen, x, px, xx);
+    int ylen = scaleExpansion(olen, o, py, y);
+    int yylen = scaleExpansion(ylen, y, py, yy);
+    int llen = expansionSum(xxlen, xx, yylen, yy, l);
+    if (negatif)
+        negate(llen, l);
+    return expansionSum(detlen, det, llen, l, resultat);
+}
+
+static double incircleExact(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy)
+{
+    // Mineurs 2x2 de toutes les paires de points
+    double ab[4], bc[4], cd[4], da[4], ac[4], bd[4];
+    int ablen = cross(ax, ay, bx, by, ab);
+    int bclen = cross(bx, by, cx, cy, bc);
+    int cdlen = cross(cx, cy, dx, dy, cd);
+    int dalen = cross(dx, dy, ax, ay, da);
+    int aclen = cross(ax, ay, cx, cy, ac);
+    int bdlen = cross(bx, by, dx, dy, bd);
+
+    // Orientations des triangles formés par trois des quatre points
+    double t[8], bcd[12], acd[12], abd[12], abc[12];
+    int tlen;
+    negate(bdlen, bd);
+    tlen = expansionSum(bclen, bc, cdlen, cd, t);
+    int bcdlen = expansionSum(tlen, t, bdlen, bd, bcd);
+    negate(bdlen, bd);
+    tlen = expansionSum(aclen, ac, cdlen, cd, t);
+    int acdlen = expansionSum(tlen, t, dalen, da, acd);
+    tlen = expansionSum(ablen, ab, bdlen, bd, t);
+    int abdlen = expansionSum(tlen, t, dalen, da, abd);
+    negate(aclen, ac);
+    tlen = expansionSum(ablen, ab, bclen, bc, t);
+    int abclen = expansionSum(tlen, t, aclen, ac, abc);
+
+    // Développement selon la colonne des relèvements x² + y²
+    double d1[100], d2[200], d3[300], d4[400];
+    double zero = 0.0;
+    int d1len = ajouteRelevement(ax, ay, bcd, bcdlen, false, &zero, 1, d1);
+    int d2len = ajouteRelevement(bx, by, acd, acdlen, true, d1, d1len, d2);
+    int d3len = ajouteRelevement(cx, cy, abd, abdlen, false, d2, d2len, d3);
+    int d4len = ajouteRelevement(dx, dy, abc, abclen, true, d3, d3len, d4);
+    return d4[d4len - 1];
+}
+
+double incircle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy)
+{
+    double adx = ax - dx;
+    double bdx = bx - dx;
+    double cdx = cx - dx;
+    double ady = ay - dy;
+    double bdy = by - dy;
+    double cdy = cy - dy;
+
+    double bdxcdy = bdx * cdy;
+    double cdxbdy = cdx * bdy;
+    double alift = adx * adx + ady * ady;
+
+    double cdxady = cdx * ady;
+    double adxcdy = adx * cdy;
+    double blift = bdx * bdx + bdy * bdy;
+
+    double adxbdy = adx * bdy;
+    double bdxady = bdx * ady;
+    double clift = cdx * cdx + cdy * cdy;
+
+    double det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) + clift * (adxbdy - bdxady);
+
+    double permanent = (std::fabs(bdxcdy) + std::fabs(cdxbdy)) * alift
+                     + (std::fabs(cdxady) + std::fabs(adxcdy)) * blift
+                     + (std::fabs(adxbdy) + std::fabs(bdxady)) * clift;
+    double errbound = iccerrboundA * permanent;
+    if (det > errbound || -det > errbound)
+        return det;
+
+    return incircleExact(ax, ay, bx, by, cx, cy, dx, dy);
+}
@@ -0,0 +1,229 @@
+#ifndef PREDICATES_H
+#define PREDICATES_H
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+// Prédicats géométriques robustes (d'après J. R. Shewchuk, "Adaptive Precision
+// Floating-Point Arithmetic and Fast Robust Geometric Predicates")
+// On calcule d'abord le déterminant en double avec une borne d'erreur ; on ne passe
+// à l'arithmétique exacte que si le signe du résultat n'est pas garanti.
+
+// Positif si a, b, c sont dans le sens direct, négatif dans le sens indirect, nul s'ils sont alignés
+double orient2d(double ax, double ay, double bx, double by, double cx, double cy);
+
+// Positif si d est strictement dans le cercle passant par a, b, c (pris dans le sens direct),
+// négatif s'il est à l'extérieur et nul s'il est sur le cercle
+double incircle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy);
+
+// Noyau de prédicats choisi à la compilation selon le type des coordonnées
+// orient et dansCercle ont le même signe que orient2d et incircle
+template <typename T>
+struct Predicats;
+
+// Coordonnées flottantes : prédicats adaptatifs
+template <>
+struct Predicats<double>
+{
+    // Au-delà, les produits de degré 4 du test du cercle risqueraient de déborder
+    static constexpr double COORD_MAX = 1e60;
+
+    static bool dansLimites(double x, double y)
+    {
+        return std::fabs(x) <= COORD_MAX && std::fabs(y) <= COORD_MAX;
+    }
+
+    static double orient(double ax, double ay, double bx, double by, double cx, double cy)
+    {
+        return orient2d(ax, ay, bx, by, cx, cy);
+    }
+
+    static double dansCercle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy)
+    {
+        return incircle(ax, ay, bx, by, cx, cy, dx, dy);
+    }
+};
+
+// Un float se convertit exactement en double : on réutilise les prédicats adaptatifs
+template <>
+struct Predicats<float>
+{
+    static bool dansLimites(float x, float y)
+    {
+        return std::isfinite(x) && std::isfinite(y);
+    }
+
+    static double orient(double ax, double ay, double bx, double by, double cx, double cy)
+    {
+        return orient2d(ax, ay, bx, by, cx, cy);
+    }
+
+    static double dansCercle(double ax, double ay, double bx, double by, double cx, double cy, double dx, double dy)
+    {
+        return incircle(ax, ay, bx, by, cx, cy, dx, dy);
+    }
+};
+
+// Coordonnées entières : calcul exact sur des entiers 64 et 128 bits, sans flottants
+template <>
+struct Predicats<int>
+{
+    // Tant que |x| et |y| restent sous cette borne, les différences tiennent sur 31 bits,
+    // leurs produits sur 64 bits et le déterminant du cercle sur 128 bits
+    static constexpr int COORD_MAX = 1 << 29;
+
+    static bool dansLimites(int x, int y)
+    {
+        return x >= -COORD_MAX && x <= COORD_MAX && y >= -COORD_MAX && y <= COORD_MAX;
+    }
+
+    static long long orient(int ax, int ay, int bx, int by, int cx, int cy)
+    {
+        return (long long)(bx - ax) * (cy - ay) - (long long)(by - ay) * (cx - ax);
+    }
+
+    static int dansCercle(int ax, int ay, int bx, int by, int cx, int cy, int dx, int dy)
+    {
+#ifdef __SIZEOF_INT128__
+        __extension__ typedef __int128 int128;
+
+        long long adx = (long long)ax - dx, ady = (long long)ay - dy;
+        long long bdx = (long long)bx - dx, bdy = (long long)by - dy;
+        long long cdx = (long long)cx - dx, cdy = (long long)cy - dy;
+
+        long long alift = adx * adx + ady * ady;
+        long long blift = bdx * bdx + bdy * bdy;
+        long long clift = cdx * cdx + cdy * cdy;
+
+        int128 det = (int128)alift * (bdx * cdy - cdx * bdy)
+                   + (int128)blift * (cdx * ady - adx * cdy)
+                   + (int128)clift * (adx * bdy - bdx * ady);
+        return (det > 0) - (det < 0);
+#else
+        // Sans entiers 128 bits, les prédicats adaptatifs restent exacts sur des entiers
+        double det = incircle(ax, ay, bx, by, cx, cy, dx, dy);
+        return (det > 0) - (det < 0);
+#endif
+    }
+};
+
+// On vérifie une fois pour toutes que la borne choisie ne fait déborder aucun calcul :
+// différences < 2^31, relèvements et produits croisés < 2^63, déterminant < 2^127
+static_assert(2LL * Predicats<int>::COORD_MAX < (1LL << 31), "les differences de coordonnees debordent");
+static_assert((2LL * Predicats<int>::COORD_MAX) * (2LL * Predicats<int>::COORD_MAX) < (1LL << 61), "le determinant du cercle deborde");
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 Entier128;
+__extension__ typedef unsigned __int128 Naturel128;
+
+// Entier signé sur 256 bits, en complément à deux, juste ce qu'il faut pour le test du cercle en 64 bits
+struct Entier256
+{
+    std::uint64_t mots[4];
+
+    // Produit exact de deux entiers 128 bits dont la valeur absolue est inférieure à 2^127
+    static Entier256 produit(Entier128 a, Entier128 b)
+    {
+        bool negatif = (a < 0) != (b < 0);
+        Naturel128 u = a < 0 ? -(Naturel128)a : (Naturel128)a;
+        Naturel128 v = b < 0 ? -(Naturel128)b : (Naturel128)b;
+
+        // Produit des moitiés de 64 bits, comme à la main
+        std::uint64_t u0 = (std::uint64_t)u, u1 = (std::uint64_t)(u >> 64);
+        std::uint64_t v0 = (std::uint64_t)v, v1 = (std::uint64_t)(v >> 64);
+        Naturel128 p00 = (Naturel128)u0 * v0;
+        Naturel128 p01 = (Naturel128)u0 * v1;
+        Naturel128 p10 = (Naturel128)u1 * v0;
+        Naturel128 p11 = (Naturel128)u1 * v1;
+
+        Entier256 r;
+        Naturel128 t = (p00 >> 64) + (std::uint64_t)p01 + (std::uint64_t)p10;
+        r.mots[0] = (std::uint64_t)p00;
+        r.mots[1] = (std::uint64_t)t;
+        t = (t >> 64) + (p01 >> 64) + (p10 >> 64) + (std::uint64_t)p11;
+        r.mots[2] = (std::uint64_t)t;
+        r.mots[3] = (std::uint64_t)((t >> 64) + (p11 >> 64));
+
+        if (negatif)
+        {
+            // -x = ~x + 1
+            std::uint64_t retenue = 1;
+            for (int i=0; i < 4; i++)
+            {
+                r.mots[i] = ~r.mots[i] + retenue;
+                retenue = retenue && r.mots[i] == 0;
+            }
+        }
+        return r;
+    }
+
+    Entier256 operator+(const Entier256& autre) const
+    {
+        Entier256 r;
+        std::uint64_t retenue = 0;
+        for (int i=0; i < 4; i++)
+        {
+            std::uint64_t s = mots[i] + retenue;
+            retenue = s < retenue;
+            r.mots[i] = s + autre.mots[i];
+            retenue += r.mots[i] < s;
+        }
+        return r;
+    }
+
+    int signe() const
+    {
+        if (mots[3] >> 63)
+            return -1;
+        return (mots[0] | mots[1] | mots[2] | mots[3]) != 0;
+    }
+};
+
+// Coordonnées entières 64 bits : orientation exacte en 128 bits, test du cercle en 128 ou 256 bits
+template <>
+struct Predicats<std::int64_t>
+{
+    // Sous cette borne, les différences tiennent sur 63 bits, relèvements et produits croisés
+    // sur 126 bits et le déterminant du cercle sur 253 bits
+    static constexpr std::int64_t COORD_MAX = (std::int64_t)1 << 61;
+
+    static bool dansLimites(std::int64_t x, std::int64_t y)
+    {
+        return x >= -COORD_MAX && x <= COORD_MAX && y >= -COORD_MAX && y <= COORD_MAX;
+    }
+
+    static int orient(std::int64_t ax, std::int64_t ay, std::int64_t bx, std::int64_t by, std::int64_t cx, std::int64_t cy)
+    {
+        Entier128 det = (Entier128)(bx - ax) * (cy - ay) - (Entier128)(by - ay) * (cx - ax);
+        return (det > 0) - (det < 0);
+    }
+
+    static int dansCercle(std::int64_t ax, std::int64_t ay, std::int64_t bx, std::int64_t by, std::int64_t cx, std::int64_t cy, std::int64_t dx, std::int64_t dy)
+    {
+        std::int64_t adx = ax - dx, ady = ay - dy;
+        std::int64_t bdx = bx - dx, bdy = by - dy;
+        std::int64_t cdx = cx - dx, cdy = cy - dy;
+
+        // Points proches : le calcul tient sur 128 bits comme pour les coordonnées 32 bits
+        const std::int64_t proche = (std::int64_t)1 << 30;
+        if (std::llabs(adx) < proche && std::llabs(ady) < proche && std::llabs(bdx) < proche
+         && std::llabs(bdy) < proche && std::llabs(cdx) < proche && std::llabs(cdy) < proche)
+        {
+            return Predicats<int>::dansCercle(adx, ady, bdx, bdy, cdx, cdy, 0, 0);
+        }
+
+        Entier128 alift = (Entier128)adx * adx + (Entier128)ady * ady;
+        Entier128 blift = (Entier128)bdx * bdx + (Entier128)bdy * bdy;
+        Entier128 clift = (Entier128)cdx * cdx + (Entier128)cdy * cdy;
+
+        Entier256 det = Entier256::produit(alift, (Entier128)bdx * cdy - (Entier128)cdx * bdy)
+                      + Entier256::produit(blift, (Entier128)cdx * ady - (Entier128)adx * cdy)
+                      + Entier256::produit(clift, (Entier128)adx * bdy - (Entier128)bdx * ady);
+        return det.signe();
+    }
+};
+
+static_assert(2 * Predicats<std::int64_t>::COORD_MAX <= ((std::int64_t)1 << 62), "les differences de coordonnees debordent");
+#endif
+
+#endif
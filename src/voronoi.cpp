@@ -0,0 +1,359 @@
+#include "voronoi.h"
+#include "parallele.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+template <typename T>
+bool construitCellule(const BasicMesh<T>& mesh, int s, std::vector<SommetVoronoi>& sommets)
+{
+    sommets.clear();
+    if (s < 0 || s >= (int)mesh.incident.size() || mesh.incident[s] < 0)
+        return false;
+
+    // Dans le triangle (s, u, v), le suivant autour de s est celui qui partage l'arête (s, v)
+    const int depart = mesh.incident[s];
+    int t = depart;
+    do
+    {
+        const Triangle& triangle = mesh.triangles[t];
+
+        // Un triangle infini ou une arête sans voisin : le site est sur l'enveloppe convexe
+        if (!triangle.fini())
+            return false;
+
+        const Cercle& C = mesh.cercles[t];
+        sommets.push_back({C.x, C.y});
+
+        int i = triangle.v[0] == s ? 0 : (triangle.v[1] == s ? 1 : 2);
+        t = triangle.voisins[(i + 1) % 3];
+        if (t == -1)
+            return false;
+    } while (t != depart);
+
+    return true;
+}
+
+// Construit les cellules des sites par tranches : chaque tranche remplit sa propre liste,
+// et on les met bout à bout dans l'ordre des sites, quel que soit le nombre de threads
+template <typename Construit>
+static void construitParTranches(size_t n, int nombreThreads, std::vector<Cellule>& cellules, const Construit& construit)
+{
+    cellules.clear();
+    const int tranches = nombreTranches(nombreThreads, n);
+    if (tranches == 1)
+    {
+        construit(0, n, cellules);
+        return;
+    }
+
+    std::vector<std::vector<Cellule>> parties(tranches);
+    enParallele(tranches, n, [&](int k, size_t debut, size_t fin){ construit(debut, fin, parties[k]); });
+    for (std::vector<Cellule>& partie : parties)
+        std::move(partie.begin(), partie.end(), std::back_inserter(cellules));
+}
+
+template <typename T>
+void construitCellules(const BasicMesh<T>& mesh, std::vector<Cellule>& cellules, int nombreThreads)
+{
+    // Pour chaque site, on tourne autour de lui dans le maillage : les sites de l'enveloppe
+    // convexe (cellules infinies) et les sites qui ne sont pas dans le maillage sont écartés
+    construitParTranches(mesh.sommets.size(), nombreThreads, cellules, [&](size_t debut, size_t fin, std::vector<Cellule>& sortie){
+        std::vector<SommetVoronoi> sommets;
+        for (int i=debut; i < (int)fin; i++)
+        {
+            if (!construitCellule(mesh, i, sommets))
+                continue;
+
+            // Les sommets sortent déjà dans l'ordre autour du site : aucun tri n'est nécessaire
+            sortie.push_back(Cellule{i, sommets});
+        }
+    });
+}
+
+// Voisins de Delaunay du site s, en tournant autour de lui dans les deux sens si les triangles
+// infinis ont été retirés (l'étoile d'un site de l'enveloppe est alors ouverte)
+template <typename T>
+static void voisinsSite(const BasicMesh<T>& mesh, int s, std::vector<int>& voisins)
+{
+    voisins.clear();
+    const int depart = mesh.incident[s];
+    int t = depart;
+    do
+    {
+        const Triangle& triangle = mesh.triangles[t];
+        int i = triangle.v[0] == s ? 0 : (triangle.v[1] == s ? 1 : 2);
+        voisins.push_back(triangle.v[(i + 1) % 3]);
+        t = triangle.voisins[(i + 1) % 3];
+        if (t == -1)
+        {
+            // L'étoile est ouverte : on termine dans l'autre sens depuis le triangle de départ
+            voisins.push_back(triangle.v[(i + 2) % 3]);
+            const Triangle& premier = mesh.triangles[depart];
+            int j = premier.v[0] == s ? 0 : (premier.v[1] == s ? 1 : 2);
+            for (t = premier.voisins[(j + 2) % 3]; t != -1; t = mesh.triangles[t].voisins[(j + 2) % 3])
+            {
+                const Triangle& precedent = mesh.triangles[t];
+                j = precedent.v[0] == s ? 0 : (precedent.v[1] == s ? 1 : 2);
+                voisins.push_back(precedent.v[(j + 1) % 3]);
+            }
+            break;
+        }
+    } while (t != depart);
+}
+
+// Garde la partie du polygone convexe où N·(X - M) <= 0 (découpage de Sutherland-Hodgman par un demi-plan)
+// Retourne false sans rien copier si le polygone est déjà entièrement du bon côté
+static bool coupeDemiPlan(const std::vector<Point<double>>& entree, const Point<double>& N, const Point<double>& M, std::vector<Point<double>>& sortie)
+{
+    bool dehors = false;
+    for (const Point<double>& A : entree)
+        dehors = dehors || N.x * (A.x - M.x) + N.y * (A.y - M.y) > 0;
+    if (!dehors)
+        return false;
+
+    sortie.clear();
+    for (size_t k=0; k < entree.size(); k++)
+    {
+        const Point<double>& A = entree[k];
+        const Point<double>& B = entree[(k + 1) % entree.size()];
+        const double fa = N.x * (A.x - M.x) + N.y * (A.y - M.y);
+        const double fb = N.x * (B.x - M.x) + N.y * (B.y - M.y);
+
+        if (fa <= 0)
+            sortie.push_back(A);
+        if ((fa < 0 && fb > 0) || (fa > 0 && fb < 0))
+        {
+            const double u = fa / (fa - fb);
+            sortie.push_back({A.x + u * (B.x - A.x), A.y + u * (B.y - A.y)});
+        }
+    }
+    return true;
+}
+
+// Découpe la cellule du site s avec des tampons réutilisés d'un site à l'autre
+template <typename T>
+static bool decoupeCellule(const BasicMesh<T>& mesh, int s, const std::vector<Point<T>>& cadre, std::vector<SommetVoronoi>& sommets,
+    std::vector<int>& voisins, std::vector<Point<double>>& polygone, std::vector<Point<double>>& coupe)
+{
+    sommets.clear();
+    if (s < 0 || s >= (int)mesh.incident.size() || mesh.incident[s] < 0)
+        return false;
+
+    // Une cellule finie est le polygone des centres des cercles, qu'on coupe par chaque côté du cadre
+    polygone.clear();
+    const int depart = mesh.incident[s];
+    int t = depart;
+    bool fermee = true;
+    do
+    {
+        const Triangle& triangle = mesh.triangles[t];
+        if (!triangle.fini())
+        {
+            fermee = false;
+            break;
+        }
+        polygone.push_back({mesh.cercles[t].x, mesh.cercles[t].y});
+        int i = triangle.v[0] == s ? 0 : (triangle.v[1] == s ? 1 : 2);
+        t = triangle.voisins[(i + 1) % 3];
+        fermee = t != -1;
+    } while (fermee && t != depart);
+
+    if (fermee)
+    {
+        for (size_t k=0; k < cadre.size() && !polygone.empty(); k++)
+        {
+            const Point<T>& A = cadre[k];
+            const Point<T>& B = cadre[(k + 1) % cadre.size()];
+            if (coupeDemiPlan(polygone, {(double)B.y - A.y, (double)A.x - B.x}, {(double)A.x, (double)A.y}, coupe))
+                polygone.swap(coupe);
+        }
+    }
+    else
+    {
+        // Site de l'enveloppe : la cellule est l'intersection du cadre et des demi-plans des médiatrices
+        // avec chaque voisin, ce qui coupe ses arêtes infinies comme les autres
+        voisinsSite(mesh, s, voisins);
+        polygone.clear();
+        for (const Point<T>& P : cadre)
+            polygone.push_back({(double)P.x, (double)P.y});
+
+        const Point<double> S{(double)mesh.sommets[s].x, (double)mesh.sommets[s].y};
+        for (size_t k=0; k < voisins.size() && !polygone.empty(); k++)
+        {
+            if (voisins[k] == INFINI)
+                continue;
+            const Point<double> V{(double)mesh.sommets[voisins[k]].x, (double)mesh.sommets[voisins[k]].y};
+            if (coupeDemiPlan(polygone, {V.x - S.x, V.y - S.y}, {(S.x + V.x) / 2, (S.y + V.y) / 2}, coupe))
+                polygone.swap(coupe);
+        }
+    }
+
+    sommets.swap(polygone);
+    return sommets.size() >= 3;
+}
+
+template <typename T>
+bool construitCelluleBornee(const BasicMesh<T>& mesh, int s, const std::vector<Point<T>>& cadre, std::vector<SommetVoronoi>& sommets)
+{
+    std::vector<int> voisins;
+    std::vector<Point<double>> polygone, coupe;
+    return decoupeCellule(mesh, s, cadre, sommets, voisins, polygone, coupe);
+}
+
+template <typename T>
+void construitCellulesBornees(const BasicMesh<T>& mesh, const std::vector<Point<T>>& cadre, std::vector<Cellule>& cellules, int nombreThreads)
+{
+    construitParTranches(mesh.sommets.size(), nombreThreads, cellules, [&](size_t debut, size_t fin, std::vector<Cellule>& sortie){
+        std::vector<int> voisins;
+        std::vector<Point<double>> polygone, coupe;
+        std::vector<SommetVoronoi> sommets;
+        for (int i=debut; i < (int)fin; i++)
+        {
+            if (decoupeCellule(mesh, i, cadre, sommets, voisins, polygone, coupe))
+                sortie.push_back(Cellule{i, sommets});
+        }
+    });
+}
+
+template <typename T>
+void construitDiagramme(const BasicMesh<T>& mesh, Diagramme& diagramme, int nombreThreads)
+{
+    const size_t nombreTriangles = mesh.triangles.size();
+    const size_t nombreSites = mesh.sommets.size();
+
+    // Un sommet par triangle fini vivant : on compte ceux de chaque tranche de triangles pour savoir
+    // où chaque tranche range les siens, puis numero donne l'indice de chaque sommet dans le diagramme
+    const int tranchesTriangles = nombreTranches(nombreThreads, nombreTriangles);
+    std::vector<size_t> premierSommet(tranchesTriangles + 1, 0);
+    enParallele(tranchesTriangles, nombreTriangles, [&](int k, size_t debut, size_t fin){
+        size_t compte = 0;
+        for (size_t t=debut; t < fin; t++)
+            compte += mesh.triangles[t].vivant && mesh.triangles[t].fini();
+        premierSommet[k + 1] = compte;
+    });
+    for (int k=0; k < tranchesTriangles; k++)
+        premierSommet[k + 1] += premierSommet[k];
+
+    diagramme.sommets.resize(premierSommet[tranchesTriangles]);
+    std::vector<int> numero(nombreTriangles, -1);
+    std::vector<std::vector<AreteVoronoi>> aretes(tranchesTriangles);
+    enParallele(tranchesTriangles, nombreTriangles, [&](int k, size_t debut, size_t fin){
+        size_t suivant = premierSommet[k];
+        for (size_t t=debut; t < fin; t++)
+        {
+            const Triangle& triangle = mesh.triangles[t];
+            if (!triangle.vivant || !triangle.fini())
+                continue;
+            numero[t] = suivant;
+            diagramme.sommets[suivant++] = {mesh.cercles[t].x, mesh.cercles[t].y};
+
+            // Chaque arête entre deux triangles finis est vue deux fois : on la garde depuis le plus petit indice
+            // Dans le triangle (p, q, r) direct, l'arête du diagramme qui traverse (q, r) a r à sa gauche
+            for (int i=0; i < 3; i++)
+            {
+                const int n = triangle.voisins[i];
+                if (n > (int)t && mesh.triangles[n].fini())
+                    aretes[k].push_back({(int)t, n, triangle.v[(i + 2) % 3], triangle.v[(i + 1) % 3]});
+            }
+        }
+    });
+
+    // Les arêtes ne connaissent encore que leurs triangles : on les range à la suite en les renumérotant
+    std::vector<size_t> premiereArete(tranchesTriangles + 1, 0);
+    for (int k=0; k < tranchesTriangles; k++)
+        premiereArete[k + 1] = premiereArete[k] + aretes[k].size();
+    diagramme.aretes.resize(premiereArete[tranchesTriangles]);
+    enParallele(tranchesTriangles, nombreTriangles, [&](int k, size_t, size_t){
+        size_t suivante = premiereArete[k];
+        for (const AreteVoronoi& arete : aretes[k])
+            diagramme.aretes[suivante++] = {numero[arete.a], numero[arete.b], arete.gauche, arete.droite};
+    });
+
+    // Les cellules bornées, en tournant autour de chaque site comme construitCellule : chaque tranche de sites
+    // range ses indices à part et note la taille de chaque cellule, puis on les recopie à leur place
+    const int tranchesSites = nombreTranches(nombreThreads, nombreSites);
+    std::vector<std::vector<int>> indices(tranchesSites);
+    diagramme.debuts.assign(nombreSites + 1, 0);
+    enParallele(tranchesSites, nombreSites, [&](int k, size_t debut, size_t fin){
+        std::vector<int>& locaux = indices[k];
+        for (size_t s=debut; s < fin; s++)
+        {
+            const size_t avant = locaux.size();
+            const int depart = mesh.incident[s];
+            int t = depart;
+            bool fermee = depart >= 0;
+            while (fermee)
+            {
+                const Triangle& triangle = mesh.triangles[t];
+                if (!triangle.fini())
+                {
+                    fermee = false;
+                    break;
+                }
+                locaux.push_back(numero[t]);
+
+                int i = triangle.v[0] == (int)s ? 0 : (triangle.v[1] == (int)s ? 1 : 2);
+                t = triangle.voisins[(i + 1) % 3];
+                fermee = t != -1;
+                if (t == depart)
+                    break;
+            }
+
+            // Cellule infinie : on oublie les sommets déjà rangés
+            if (!fermee)
+                locaux.resize(avant);
+            diagramme.debuts[s + 1] = locaux.size() - avant;
+        }
+    });
+
+    std::vector<size_t> premierIndice(tranchesSites + 1, 0);
+    for (int k=0; k < tranchesSites; k++)
+        premierIndice[k + 1] = premierIndice[k] + indices[k].size();
+    diagramme.indices.resize(premierIndice[tranchesSites]);
+    enParallele(tranchesSites, nombreSites, [&](int k, size_t debut, size_t fin){
+        std::copy(indices[k].begin(), indices[k].end(), diagramme.indices.begin() + premierIndice[k]);
+        int cumul = premierIndice[k];
+        for (size_t s=debut; s < fin; s++)
+        {
+            cumul += diagramme.debuts[s + 1];
+            diagramme.debuts[s + 1] = cumul;
+        }
+    });
+}
+
+template bool construitCellule(const BasicMesh<int>&, int, std::vector<SommetVoronoi>&);
+template bool construitCellule(const BasicMesh<float>&, int, std::vector<SommetVoronoi>&);
+template bool construitCellule(const BasicMesh<double>&, int, std::vector<SommetVoronoi>&);
+#ifdef __SIZEOF_INT128__
+template bool construitCellule(const BasicMesh<std::int64_t>&, int, std::vector<SommetVoronoi>&);
+#endif
+
+template void construitCellules<int>(const BasicMesh<int>&, std::vector<Cellule>&, int);
+template void construitCellules<float>(const BasicMesh<float>&, std::vector<Cellule>&, int);
+template void construitCellules<double>(const BasicMesh<double>&, std::vector<Cellule>&, int);
+#ifdef __SIZEOF_INT128__
+template void construitCellules<std::int64_t>(const BasicMesh<std::int64_t>&, std::vector<Cellule>&, int);
+#endif
+
+template bool construitCelluleBornee<int>(const BasicMesh<int>&, int, const std::vector<Point<int>>&, std::vector<SommetVoronoi>&);
+template bool construitCelluleBornee<float>(const BasicMesh<float>&, int, const std::vector<Point<float>>&, std::vector<SommetVoronoi>&);
+template bool construitCelluleBornee<double>(const BasicMesh<double>&, int, const std::vector<Point<double>>&, std::vector<SommetVoronoi>&);
+#ifdef __SIZEOF_INT128__
+template bool construitCelluleBornee<std::int64_t>(const BasicMesh<std::int64_t>&, int, const std::vector<Point<std::int64_t>>&, std::vector<SommetVoronoi>&);
+#endif
+
+template void construitCellulesBornees<int>(const BasicMesh<int>&, const std::vector<Point<int>>&, std::vector<Cellule>&, int);
+template void construitCellulesBornees<float>(const BasicMesh<float>&, const std::vector<Point<float>>&, std::vector<Cellule>&, int);
+template void construitCellulesBornees<double>(const BasicMesh<double>&, const std::vector<Point<double>>&, std::vector<Cellule>&, int);
+#ifdef __SIZEOF_INT128__
+template void construitCellulesBornees<std::int64_t>(const BasicMesh<std::int64_t>&, const std::vector<Point<std::int64_t>>&, std::vector<Cellule>&, int);
+#endif
+
+template void construitDiagramme(const BasicMesh<int>&, Diagramme&, int);
+template void construitDiagramme(const BasicMesh<float>&, Diagramme&, int);
+template void construitDiagramme(const BasicMesh<double>&, Diagramme&, int);
+#ifdef __SIZEOF_INT128__
+template void construitDiagramme(const BasicMesh<std::int64_t>&, Diagramme&, int);
+#endif
@@ -0,0 +1,84 @@
+#ifndef VORONOI_H
+#define VORONOI_H
+#include "geometry.h"
+#include "delaunay.h"
+#include <vector>
+
+// Sommet du diagramme, en double quel que soit le type des sites : deux cellules voisines calculées
+// séparément ont exactement les mêmes sommets communs ; on n'arrondit qu'à l'affichage
+typedef Point<double> SommetVoronoi;
+
+// Cellule de Voronoi d'un site : ses sommets sont les centres des cercles circonscrits
+// des triangles qui entourent le site, dans le sens trigonométrique autour du site
+// (la même structure quel que soit le type des coordonnées des sites, comme Diagramme)
+struct Cellule
+{
+    int site;
+    std::vector<SommetVoronoi> sommets;
+};
+
+// Arête finie du diagramme entre les sommets a et b : le site gauche est à gauche quand on va de a vers b
+struct AreteVoronoi
+{
+    int a, b;
+    int gauche, droite;
+};
+
+// Diagramme de Voronoi compact : chaque sommet n'est stocké qu'une fois (un par triangle fini)
+// et les cellules ne sont que des indices dans sommets, rangés à la suite (format CSR) :
+// la cellule du site s est indices[debuts[s]] .. indices[debuts[s + 1] - 1], dans le sens trigonométrique,
+// vide pour les sites sans cellule bornée
+struct Diagramme
+{
+    std::vector<SommetVoronoi> sommets;
+    std::vector<int> debuts;
+    std::vector<int> indices;
+    std::vector<AreteVoronoi> aretes;
+
+    int nombreSommets(int s) const
+    {
+        return debuts[s + 1] - debuts[s];
+    }
+};
+
+// Construit la cellule du site s en tournant autour de lui dans le maillage, sans rien trier :
+// les sommets sortent dans l'ordre des triangles autour du site
+// Retourne false si la cellule est infinie (site de l'enveloppe convexe) ou si le site n'est pas
+// dans le maillage ; coûte le nombre de voisins du site, pour rafraîchir une cellule après une insertion
+template <typename T>
+bool construitCellule(const BasicMesh<T>& mesh, int s, std::vector<SommetVoronoi>& sommets);
+
+// Construit les cellules bornées du diagramme de Voronoi à partir de la triangulation, en tournant
+// autour de chaque site : le coût suit le nombre de triangles et non plus sites × triangles
+// Les sites de l'enveloppe convexe (cellules infinies) et les sites confondus n'ont pas de cellule
+// Instanciée pour les mêmes types de coordonnées que la triangulation
+// Les sites sont répartis sur nombreThreads threads (0 pour tous les coeurs) ; le résultat ne dépend
+// pas du nombre de threads, et il en va de même pour les autres fonctions qui en prennent un
+template <typename T>
+void construitCellules(const BasicMesh<T>& mesh, std::vector<Cellule>& cellules, int nombreThreads = 1);
+
+// Construit le diagramme compact : les mêmes cellules que construitCellules, plus les arêtes
+// entre deux sommets finis avec les sites de part et d'autre (les arêtes infinies sont omises)
+template <typename T>
+void construitDiagramme(const BasicMesh<T>& mesh, Diagramme& diagramme, int nombreThreads = 1);
+
+// Cadre rectangulaire pour le découpage des cellules, dans le sens trigonométrique
+template <typename T>
+std::vector<Point<T>> cadreRectangle(T xmin, T ymin, T xmax, T ymax)
+{
+    return {{xmin, ymin}, {xmax, ymin}, {xmax, ymax}, {xmin, ymax}};
+}
+
+// Construit la cellule du site s découpée par le cadre, un polygone convexe dans le sens trigonométrique
+// Les sites de l'enveloppe convexe ont aussi une cellule : leurs arêtes infinies sont coupées par le cadre
+// Retourne false si le site n'est pas dans le maillage ou si sa cellule est en dehors du cadre
+// Fonctionne avec ou sans les triangles infinis ; coûte le nombre de voisins × la taille du polygone
+template <typename T>
+bool construitCelluleBornee(const BasicMesh<T>& mesh, int s, const std::vector<Point<T>>& cadre, std::vector<SommetVoronoi>& sommets);
+
+// Construit les cellules de tous les sites découpées par le cadre : toutes sont finies et ne
+// débordent pas du cadre, ce qui borne le coût de l'affichage et permet de les exporter
+template <typename T>
+void construitCellulesBornees(const BasicMesh<T>& mesh, const std::vector<Point<T>>& cadre, std::vector<Cellule>& cellules, int nombreThreads = 1);
+
+#endif